@@ -0,0 +1,94 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# All the stochastic operators at once: random positions and momenta, tunnel ionization,
+# collisions with collisional ionization and thermalizing boundaries.
+# The random numbers only depend on the seed, the patch and the timestep, so that the
+# results must be the same whatever the number of restarts: run with
+#     python validation.py -b tst1d_12_random_restart.py -r 2
+
+import math
+l0 = 2.0*math.pi	# wavelength in normalized units
+t0 = l0				# optical cycle in normalized units
+resx = 100.			# nb cells in 1 wavelength
+rest = 150.			# nb of timestep in 1 optical cycle
+
+Main(
+	geometry = "1Dcartesian",
+	
+	interpolation_order = 2,
+	
+	cell_length = [l0/resx],
+	grid_length  = [4.*l0],
+	
+	number_of_patches = [ 8 ],
+	
+	timestep = t0/rest,
+	simulation_time = 4.*t0,
+	
+	EM_boundary_conditions = [ ['silver-muller'] ],
+	
+	reference_angular_frequency_SI = 2.*math.pi*3e8/1e-6,
+	
+	random_seed = 0
+)
+
+Species(
+	name = 'carbon',
+	ionization_model = 'tunnel',
+	ionization_electrons = 'electron',
+	atomic_number = 6,
+	position_initialization = 'random',
+	momentum_initialization = 'maxwell-juettner',
+	temperature = [1e-5],
+	particles_per_cell = 16,
+	mass = 1836.0*12.,
+	charge = 1.0,
+	number_density = trapezoidal(0.05, xvacuum=0.5*l0, xplateau=3.*l0),
+	boundary_conditions = [
+		["reflective", "reflective"],
+	],
+)
+
+Species(
+	name = 'electron',
+	position_initialization = 'random',
+	momentum_initialization = 'maxwell-juettner',
+	temperature = [0.01],
+	particles_per_cell = 16,
+	mass = 1.0,
+	charge = -1.0,
+	number_density = trapezoidal(0.05, xvacuum=0.5*l0, xplateau=3.*l0),
+	boundary_conditions = [
+		["thermalize", "thermalize"],
+	],
+	thermal_boundary_temperature = [0.01],
+	thermal_boundary_velocity = [0.,0.,0.],
+)
+
+Collisions(
+	species1 = ["electron"],
+	species2 = ["carbon"],
+	coulomb_log = 3.,
+	ionizing = True
+)
+
+Laser(
+	box_side = "xmin",
+	omega = 1.,
+	chirp_profile = tconstant(),
+	time_envelope = tgaussian(start=0., duration=2.*t0, fwhm=t0, center=t0),
+	space_envelope = [0.02, 0.],
+)
+
+DiagScalar(every = 10)
+
+DiagParticleBinning(
+	deposited_quantity = "weight",
+	every = 50,
+	species = ["carbon"],
+	axes = [
+		["charge",  -0.5, 6.5, 7]
+	]
+)
@@ -0,0 +1,99 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# Drifting thermal plasma, with currents projected by the vectorized operators.
+# The reference is generated with Main.vecto=False (scalar projectors).
+
+import math as m
+
+
+TkeV = 10.						# electron & ion temperature in keV
+T   = TkeV/511.   				# electron & ion temperature in me c^2
+n0  = 1.
+Lde = m.sqrt(T)					# Debye length in units of c/\omega_{pe}
+dx  = 0.5*Lde 					# cell length (same in x & y)
+dy  = dx
+dz  = dx
+dt  = 0.95 * dx/m.sqrt(3.)		# timestep (0.95 x CFL)
+
+Lx    = 16.*dx
+Ly    = 16.*dy
+Lz    = 16.*dz
+Tsim  = 40.*dt
+
+def n0_(x,y,z):
+	if (0.1*Lx<x<0.9*Lx) and (0.1*Ly<y<0.9*Ly) and (0.1*Lz<z<0.9*Lz):
+		return n0
+	else:
+		return 0.
+
+
+Main(
+    geometry = "3Dcartesian",
+    
+    interpolation_order = 2,
+    
+    timestep = dt,
+    simulation_time = Tsim,
+    
+    cell_length  = [dx,dy,dz],
+    grid_length = [Lx,Ly,Lz],
+    
+    number_of_patches = [2,2,2],
+    
+    clrw = 4,
+    
+    vecto = True,
+    
+    EM_boundary_conditions = [ ["periodic"] ],
+    
+    print_every = 10,
+
+    random_seed = 0
+)
+
+
+Species(
+    name = "proton",
+    position_initialization = "random",
+    momentum_initialization = "mj",
+    particles_per_cell = 8, 
+    c_part_max = 1.0,
+    mass = 1836.0,
+    charge = 1.0,
+    charge_density = n0_,
+    mean_velocity = [0., 0.0, 0.0],
+    temperature = [T],
+    pusher = "boris",
+    boundary_conditions = [
+    	["periodic", "periodic"],
+    	["periodic", "periodic"],
+    	["periodic", "periodic"],
+    ],
+)
+Species(
+    name = "electron",
+    position_initialization = "random",
+    momentum_initialization = "mj",
+    particles_per_cell = 8, 
+    c_part_max = 1.0,
+    mass = 1.0,
+    charge = -1.0,
+    charge_density = n0_,
+    mean_velocity = [0.1, 0.05, 0.02],
+    temperature = [T],
+    pusher = "boris",
+    boundary_conditions = [
+    	["periodic", "periodic"],
+    	["periodic", "periodic"],
+    	["periodic", "periodic"],
+    ],
+)
+
+DiagFields(
+    every = 20,
+    fields = ["Ex", "Ey", "Ez", "Jx", "Jy", "Jz"]
+)
+
+DiagScalar(every = 1)
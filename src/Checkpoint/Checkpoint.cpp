@@ -7,8 +7,12 @@
 #include "Checkpoint.h"
 
 #include <sstream>
+#include <fstream>
 #include <iomanip>
 #include <string>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
 
 #include <mpi.h>
 
@@ -38,13 +42,17 @@ exit_asap(false),
 dump_step(0),
 dump_minutes(0.0),
 exit_after_dump(true),
+dump_asynchronous(false),
+async_write_time(0.),
 time_reference(MPI_Wtime()),
 time_dump_step(0),
 keep_n_dumps(2),
 keep_n_dumps_max(10000),
 dump_deflate(0),
 dump_request(smpi->getSize()),
-file_grouping(0)
+file_grouping(0),
+current_image(0),
+async_write_error("")
 {
     
     if( PyTools::nComponents("Checkpoints") > 0 ) {
@@ -69,6 +77,8 @@ file_grouping(0)
         
         PyTools::extract("exit_after_dump", exit_after_dump, "Checkpoints");
         
+        PyTools::extract("dump_asynchronous", dump_asynchronous, "Checkpoints");
+        
         PyTools::extract("dump_deflate", dump_deflate, "Checkpoints");
         
         if (PyTools::extract("file_grouping", file_grouping, "Checkpoints") && file_grouping > 0) {
@@ -120,6 +130,8 @@ file_grouping(0)
             message << " keeping "<< keep_n_dumps << " dumps at maximum";
             MESSAGE(1,message.str());
         }
+        if (dump_asynchronous)
+            MESSAGE(1,"Dump files are written asynchronously by a separate I/O thread");
     }
         
     // registering signal handler
@@ -133,6 +145,12 @@ file_grouping(0)
     nDim_particle=params.nDim_particle;
 }
 
+Checkpoint::~Checkpoint()
+{
+    if( dump_thread.joinable() )
+        dump_thread.join();
+}
+
 void Checkpoint::dump( VectorPatch &vecPatches, unsigned int itime, SmileiMPI* smpi, SimWindow* simWindow, Params &params ) {
     
     // check for excedeed time
@@ -183,7 +201,14 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, unsigned int itime,  SmileiMP
     std::string dumpName=nameDumpTmp.str();
 
 
-    hid_t fid = H5Fcreate( dumpName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    // In asynchronous mode, the file is built in memory (HDF5 core driver without backing store)
+    hid_t fapl = H5P_DEFAULT;
+    if (dump_asynchronous) {
+        fapl = H5Pcreate(H5P_FILE_ACCESS);
+        H5Pset_fapl_core(fapl, 16*1024*1024, 0);
+    }
+    
+    hid_t fid = H5Fcreate( dumpName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
     dump_number++;
     
 #ifdef  __DEBUG
@@ -199,6 +224,9 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, unsigned int itime,  SmileiMP
     H5::attr(fid, "dump_step", itime);
     H5::attr(fid, "dump_number", dump_number);
     
+    // The random seed is needed to continue the random streams
+    H5::attr(fid, "random_seed", params.random_seed);
+    
     H5::vect( fid, "patch_count", smpi->patch_count );
     
     // Write diags scalar data
@@ -260,10 +288,58 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, unsigned int itime,  SmileiMP
     if (simWin!=NULL)
         dumpMovingWindow(fid, simWin);
     
-    H5Fclose( fid );
+    if (dump_asynchronous) {
+        // Copy the file image in the staging buffer
+        H5Fflush( fid, H5F_SCOPE_GLOBAL );
+        ssize_t image_size = H5Fget_file_image( fid, NULL, 0 );
+        if( image_size < 0 )
+            ERROR("Could not get the size of the file image of the dump " << dumpName);
+        file_image[current_image].resize( image_size );
+        if( H5Fget_file_image( fid, file_image[current_image].data(), image_size ) < 0 )
+            ERROR("Could not copy the file image of the dump " << dumpName);
+        H5Fclose( fid );
+        H5Pclose( fapl );
+        
+        // The previous dump must be written before starting the next one
+        waitDump();
+        dump_thread = std::thread( &Checkpoint::writeFileImage, this, dumpName, current_image );
+        current_image = 1 - current_image;
+    } else {
+        H5Fclose( fid );
+    }
     
 }
 
+void Checkpoint::writeFileImage( std::string filename, unsigned int image )
+{
+    auto start = std::chrono::steady_clock::now();
+    
+    ofstream file( filename.c_str(), ofstream::out | ofstream::binary | ofstream::trunc );
+    if( ! file.is_open() ) {
+        async_write_error = "could not open " + filename + " (" + strerror( errno ) + ")";
+    } else {
+        if( ! file_image[image].empty() )
+            file.write( file_image[image].data(), file_image[image].size() );
+        file.close();
+        if( file.fail() )
+            async_write_error = "could not write " + filename + " (" + strerror( errno ) + ")";
+    }
+    
+    // Release the staging memory until the next dump
+    std::vector<char>().swap( file_image[image] );
+    
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    async_write_time += elapsed.count();
+}
+
+void Checkpoint::waitDump()
+{
+    if( dump_thread.joinable() )
+        dump_thread.join();
+    if( ! async_write_error.empty() )
+        ERROR("Asynchronous dump failed: " << async_write_error);
+}
+
 void Checkpoint::dumpPatch( ElectroMagn* EMfields, std::vector<Species*> vecSpecies, hid_t patch_gid )
 {
     
@@ -425,6 +501,11 @@ void Checkpoint::restartAll( VectorPatch &vecPatches,  SmileiMPI* smpi, SimWindo
     hid_t fid = H5Fopen( restart_file.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
     if (fid < 0) ERROR(restart_file << " is not a valid HDF5 file");    
     
+    // Read the random seed (not available in older dumps)
+    if (H5::hasAttr(fid, "random_seed")) {
+        H5::getAttr(fid, "random_seed", params.random_seed);
+    }
+    
     // Write diags scalar data
     DiagnosticScalar* scalars = static_cast<DiagnosticScalar*>(vecPatches.globalDiags[0]);
     H5::getAttr(fid, "Energy_time_zero",  scalars->Energy_time_zero );
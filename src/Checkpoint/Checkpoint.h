@@ -9,6 +9,7 @@
 
 #include <string>
 #include <vector>
+#include <thread>
 
 #include <hdf5.h>
 #include <Tools.h>
@@ -32,7 +33,7 @@ class Checkpoint {
 public:
     Checkpoint( Params& params, SmileiMPI* smpi );
     //! Destructor for Checkpoint
-    virtual ~Checkpoint(){};
+    virtual ~Checkpoint();
     
     //! Space dimension of a particle
     unsigned int nDim_particle;
@@ -57,6 +58,9 @@ public:
     void dumpAll( VectorPatch &vecPatches, unsigned int itime,  SmileiMPI* smpi, SimWindow* simWin, Params &params );
     void dumpPatch( ElectroMagn* EMfields, std::vector<Species*> vecSpecies, hid_t patch_gid );
     
+    //! wait until the file of the last asynchronous dump is written
+    void waitDump();
+    
     //! incremental number of times we've done a dump
     unsigned int dump_number;
     
@@ -91,6 +95,12 @@ public:
     //! exit once dump done
     bool exit_after_dump;
     
+    //! dump in memory, then write the file in a separate I/O thread while the simulation continues
+    bool dump_asynchronous;
+    
+    //! time spent by the I/O thread writing the asynchronous dumps
+    double async_write_time;
+    
 private:
     
     //! initialize the time zero of the simulation 
@@ -102,6 +112,9 @@ private:
     //! dump moving window parameters
     void dumpMovingWindow(hid_t fid, SimWindow* simWindow);
     
+    //! write a file image to disk (executed by the I/O thread)
+    void writeFileImage(std::string filename, unsigned int image);
+    
     //! function that returns elapsed time from creator (uses private var time_reference)
     //double time_seconds();
     
@@ -134,6 +147,16 @@ private:
     
     //! restart file
     std::string restart_file;
+    
+    //! in-memory HDF5 file images of the asynchronous dumps: one is filled while the other is written
+    std::vector<char> file_image[2];
+    unsigned int current_image;
+    
+    //! I/O thread of the asynchronous dumps
+    std::thread dump_thread;
+    
+    //! set by the I/O thread if the file could not be written (empty if no error)
+    std::string async_write_error;
 
 };
 
@@ -202,7 +202,7 @@ void CollisionalIonization::prepare3(double timestep, double n_patch_per_cell)
 }
 
 // Method to apply the ionization
-void CollisionalIonization::apply(Particles *p1, int i1, Particles *p2, int i2)
+void CollisionalIonization::apply(Random *rand, Particles *p1, int i1, Particles *p2, int i2)
 {
     double gamma_s, gamma1, gamma2;
     gamma1 = p1->lor_fac(i1);
@@ -214,14 +214,14 @@ void CollisionalIonization::apply(Particles *p1, int i1, Particles *p2, int i2)
         - p1->momentum(2,i1)*p2->momentum(2,i2);
     // Calculate the rest of the stuff
     if( electronFirst ) {
-        calculate(gamma_s, gamma1, gamma2, p1, i1, p2, i2);
+        calculate(rand, gamma_s, gamma1, gamma2, p1, i1, p2, i2);
     } else {
-        calculate(gamma_s, gamma2, gamma1, p2, i2, p1, i1);
+        calculate(rand, gamma_s, gamma2, gamma1, p2, i2, p1, i1);
     }
 }
 
 // Method used by ::apply so that we are sure that electrons are the first species
-void CollisionalIonization::calculate(double gamma_s, double gammae, double gammai, 
+void CollisionalIonization::calculate(Random *rand, double gamma_s, double gammae, double gammai, 
     Particles *pe, int ie, Particles *pi, int ii)
 {
     double We, Wi; // weights
@@ -243,7 +243,7 @@ void CollisionalIonization::calculate(double gamma_s, double gammae, double gamm
     WiWe = 1./WeWi;
     
     // Make a random number to choose if ionization or not
-    U1 = Rand::uniform();
+    U1 = rand->uniform();
     
     // Loop for multiple ionization
     // k+1 is the number of ionizations
@@ -295,7 +295,7 @@ void CollisionalIonization::calculate(double gamma_s, double gammae, double gamm
         if( U1 < cum_prob ) break;
         
         // Otherwise, we do the ionization
-        U2 = Rand::uniform();
+        U2 = rand->uniform();
         p2 = gamma_s*gamma_s - 1.;
         // Ionize the atom and create electron
         if( U2 < WeWi ) {
@@ -7,6 +7,7 @@
 #include "Tools.h"
 #include "Species.h"
 #include "Params.h"
+#include "Random.h"
 
 class Patch;
 
@@ -41,7 +42,7 @@ public:
     virtual void prepare2(Particles *p1, int i1, Particles *p2, int i2, bool);
     virtual void prepare3(double, double);
     //! Method to apply the ionization
-    virtual void apply(Particles *p1, int i1, Particles *p2, int i2);
+    virtual void apply(Random *rand, Particles *p1, int i1, Particles *p2, int i2);
     //! Method to finish the ionization and put new electrons in place
     virtual void finish(Species *s1, Species *s2, Params&, Patch*, std::vector<Diagnostic*>&);
     
@@ -93,7 +94,7 @@ private:
     std::vector<double> prob;
     
     //! Method called by ::apply to calculate the ionization, being sure that electrons are the first species
-    void calculate(double, double, double, Particles *pe, int ie, Particles *pi, int ii);
+    void calculate(Random *rand, double, double, double, Particles *pe, int ie, Particles *pi, int ii);
     
 };
 
@@ -109,7 +110,7 @@ public:
     
     void prepare2(Particles*, int, Particles*, int, bool) override {};
     void prepare3(double, double) override {};
-    void apply(Particles*, int, Particles*, int) override {};
+    void apply(Random*, Particles*, int, Particles*, int) override {};
     //void finish(Species*, Species*, Params&, Patch*) override {};
     void finish(Species*, Species*, Params&, Patch*, std::vector<Diagnostic*>&) override {};
 };
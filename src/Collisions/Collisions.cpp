@@ -47,6 +47,7 @@ filename(filename)
         Ionization = new CollisionalNoIonization();
     }
     
+    measured_time = 0.;
 }
 
 
@@ -68,6 +69,8 @@ Collisions::Collisions( Collisions* coll, int nDim )
     } else {
         Ionization = new CollisionalNoIonization();
     }
+    
+    measured_time = 0.;
 }
 
 
@@ -168,6 +171,11 @@ void Collisions::collide(Params& params, Patch* patch, int itime, vector<Diagnos
     
     bool debug = (debug_every > 0 && itime % debug_every == 0); // debug only every N timesteps
     
+    double start_time = MPI_Wtime();
+    
+    // Random stream of this patch, collision group and timestep
+    random.init( params.random_seed, patch->hindex, Random::stream_collisions + n_collisions, itime );
+    
     if( debug ) {
         smean       = 0.;
         logLmean    = 0.;
@@ -210,7 +218,7 @@ void Collisions::collide(Params& params, Patch* patch, int itime, vector<Diagnos
     //    (It does not really exchange them, it is just a temporary re-indexing)
     index1.resize(npart1);
     for (unsigned int i=0; i<npart1; i++) index1[i] = i; // first, we make an ordered array
-    random_shuffle(index1.begin(), index1.end()); // shuffle the index array
+    shuffle(index1.begin(), index1.end(), random); // shuffle the index array
     if (intra_collisions) { // In the case of collisions within one species
         npairs = (int) ceil(((double)npart1)/2.); // half as many pairs as macro-particles
         index2.resize(npairs);
@@ -348,10 +356,10 @@ void Collisions::collide(Params& params, Patch* patch, int itime, vector<Diagnos
         if (s>smax) s = smax;
         
         // Pick the deflection angles according to Nanbu's theory
-        cosX = cos_chi(s);
+        cosX = cos_chi(s, &random);
         sinX = sqrt( 1. - cosX*cosX );
         //!\todo make a faster rand by preallocating ??
-        phi = twoPi * Rand::uniform();
+        phi = twoPi * random.uniform();
         
         // Calculate combination of angles
         sinXcosPhi = sinX*cos(phi);
@@ -373,7 +381,7 @@ void Collisions::collide(Params& params, Patch* patch, int itime, vector<Diagnos
         // Random number to choose whether deflection actually applies.
         // This is to conserve energy in average when weights are not equal.
         //!\todo make a faster rand by preallocating ??
-        U = Rand::uniform();
+        U = random.uniform();
         
         // Go back to the lab frame and store the results in the particle array
         vcp = COM_vx * newpx_COM + COM_vy * newpy_COM + COM_vz * newpz_COM;
@@ -391,7 +399,7 @@ void Collisions::collide(Params& params, Patch* patch, int itime, vector<Diagnos
         }
         
         // Handle ionization
-        Ionization->apply(p1, i1, p2, i2);
+        Ionization->apply(&random, p1, i1, p2, i2);
         
         if( debug ) {
             smean    += s;
@@ -412,6 +420,8 @@ void Collisions::collide(Params& params, Patch* patch, int itime, vector<Diagnos
             //temperature /= ncol;
         }
     }
+    
+    measured_time += MPI_Wtime() - start_time;
 }
 
 
@@ -492,12 +502,12 @@ void Collisions::debug(Params& params, int itime, unsigned int icoll, VectorPatc
 // It involves the "s" parameter (~ collision frequency * deflection expectation)
 //   and a random number "U".
 // Technique slightly modified in http://dx.doi.org/10.1063/1.4742167
-inline double Collisions::cos_chi(double s)
+inline double Collisions::cos_chi(double s, Random * rand)
 {
     
     double A, invA;
     //!\todo make a faster rand by preallocating ??
-    double U = Rand::uniform();
+    double U = rand->uniform();
     
     if( s < 0.1 ) {
         if ( U<0.0001 ) U=0.0001; // ensures cos_chi > 0
@@ -6,6 +6,7 @@
 #include "Tools.h"
 #include "H5.h"
 #include "CollisionalIonization.h"
+#include "Random.h"
 
 class Patch;
 class Params;
@@ -44,11 +45,14 @@ public:
     static void debug(Params& params, int itime, unsigned int icoll, VectorPatch& vecPatches);
     
     //! Deflection angle calculation
-    static double cos_chi(double);
+    static double cos_chi(double, Random*);
     
     //! CollisionalIonization object, created if ionization required
     CollisionalIonization * Ionization;
     
+    //! Time spent in collide() since the last load balancing (measured load of the patch)
+    double measured_time;
+    
 private:
     
     //! Identification number of the Collisions object
@@ -74,6 +78,9 @@ private:
     
     //! Temporary variables for the debugging file
     double smean, logLmean, ncol;//, temperature
+    
+    //! Random number generator, re-initialized at each timestep
+    Random random;
 };
 
 
@@ -552,7 +552,7 @@ template<typename T>
 void DiagnosticTrack::fill_buffer(VectorPatch& vecPatches, unsigned int iprop, vector<T>& buffer)
 {
     unsigned int patch_nParticles, i, j, nPatches=vecPatches.size();
-    vector<T>* property = NULL;
+    aligned_vector<T>* property = NULL;
     
     if( has_filter ) {
         #pragma omp for schedule(runtime)
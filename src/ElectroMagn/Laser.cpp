@@ -99,18 +99,31 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
         // omega
         info << "\t\t\tomega              : " << omega_value << endl;
         
+        // Python time profiles are tabulated, with some margin as the time envelope
+        // is evaluated at retarded times depending on the phase
+        double tmax = params.simulation_time + params.timestep;
+        double margin = 0.1*tmax;
+        double tolerance;
+        PyTools::extract("tabulation_tolerance",tolerance,"Laser",ilaser);
+        if( tolerance <= 0. )
+            ERROR(errorPrefix << ": tabulation_tolerance must be positive");
+        
         // chirp
         name.str("");
         name << "Laser[" << ilaser <<"].chirp_profile";
         pchirp = new Profile(chirp_profile, 1, name.str());
-        pchirp2 = new Profile(chirp_profile, 1, name.str());
+        if( ! pchirp->tabulate( -margin, tmax+margin, params.timestep, tolerance ) )
+            WARNING(name.str() << ": tabulated with reduced accuracy (discontinuous profile?)");
+        pchirp2 = new Profile(pchirp);
         info << "\t\t\tchirp_profile      : " << pchirp->getInfo();
         
         // time envelope
         name.str("");
         name << "Laser[" << ilaser <<"].time_envelope";
         ptime = new Profile(time_profile, 1, name.str());
-        ptime2 = new Profile(time_profile, 1, name.str());
+        if( ! ptime->tabulate( -margin, tmax+margin, params.timestep, tolerance ) )
+            WARNING(name.str() << ": tabulated with reduced accuracy (discontinuous profile?)");
+        ptime2 = new Profile(ptime);
         info << endl << "\t\t\ttime envelope      : " << ptime->getInfo();
          
         // space envelope (By)
@@ -319,16 +332,12 @@ void LaserProfileSeparable::initFields(Params& params, Patch* patch)
 
 
 // Amplitude of a separable laser profile
+// (time profiles are either built-in or tabulated: no need for a critical section)
 double LaserProfileSeparable::getAmplitude(std::vector<double> pos, double t, int j, int k)
 {
-    double amp;
-    #pragma omp critical
-    {
-        double omega_ = omega * chirpProfile->valueAt(t);
-        double phi = (*phase)(j, k);
-        amp = timeProfile->valueAt(t-(phi+delay_phase)/omega_) * (*space_envelope)(j, k) * sin( omega_*t - phi );
-    }
-    return amp;
+    double omega_ = omega * chirpProfile->valueAt(t);
+    double phi = (*phase)(j, k);
+    return timeProfile->valueAt(t-(phi+delay_phase)/omega_) * (*space_envelope)(j, k) * sin( omega_*t - phi );
 }
 
 //Destructor
@@ -154,14 +154,14 @@ void Interpolator1D2Order::operator() (ElectroMagn* EMfields, Particles &particl
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
     
-    //Loop on bin particles
-    int npart_tot = particles.size();
+    //Loop on bin particles (thread buffers only hold the particles of the bin)
+    int npart_tot = *iend-*istart;
     for (int ipart=*istart ; ipart<*iend; ipart++ ) {
         //Interpolation on current particle
-        (*this)(EMfields, particles, ipart, npart_tot, &(*Epart)[ipart], &(*Bpart)[ipart]);
+        (*this)(EMfields, particles, ipart, npart_tot, &(*Epart)[ipart-*istart], &(*Bpart)[ipart-*istart]);
         //Buffering of iol and delta
-        (*iold)[ipart] = ip_;
-        (*delta)[ipart] = xjmxi;
+        (*iold)[ipart-*istart] = ip_;
+        (*delta)[ipart-*istart] = xjmxi;
     }
     
 }
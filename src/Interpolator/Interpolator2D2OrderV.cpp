@@ -0,0 +1,147 @@
+#include "Interpolator2D2OrderV.h"
+
+#include <cmath>
+#include <iostream>
+
+#include "ElectroMagn.h"
+#include "Field2D.h"
+#include "Particles.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Creator for Interpolator2D2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Interpolator2D2OrderV::Interpolator2D2OrderV(Params &params, Patch *patch) : Interpolator2D2Order(params, patch)
+{
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 2nd order coefficients of the 3 nodes around the central node, for the particle i of a pack
+// ---------------------------------------------------------------------------------------------------------------------
+static inline void coefficients(double delta, double* coeff, int N, int i)
+{
+    double delta2 = delta*delta;
+    coeff[    i] = 0.5 * (delta2-delta+0.25);
+    coeff[  N+i] = 0.75 - delta2;
+    coeff[2*N+i] = 0.5 * (delta2+delta+0.25);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Gather the field f at the particles of a pack
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator2D2OrderV::gather(Field2D* f, double* coeffx, double* coeffy, int* idx, int* idy, double* out, int npack)
+{
+    const int N = vecto_size;
+
+    // Bounds of the stencils of the pack
+    int imin = idx[0], imax = idx[0], jmin = idy[0], jmax = idy[0];
+    for (int ipart=1 ; ipart<npack ; ipart++) {
+        imin = min( imin, idx[ipart] );
+        imax = max( imax, idx[ipart] );
+        jmin = min( jmin, idy[ipart] );
+        jmax = max( jmax, idy[ipart] );
+    }
+
+    double tile[tile_size*tile_size];
+    double* field;
+    int stride, i0, j0;
+    if ( imax-imin <= tile_size-3 && jmax-jmin <= tile_size-3 ) {
+        // Copy the tile covering the stencils of the pack
+        i0 = imin-1;
+        j0 = jmin-1;
+        for (int i=0 ; i<imax-imin+3 ; i++)
+            for (int j=0 ; j<jmax-jmin+3 ; j++)
+                tile[i*tile_size+j] = (*f)(i0+i, j0+j);
+        field  = tile;
+        stride = tile_size;
+    } else {
+        // Particles of the pack are too far apart: gather from the whole field
+        i0 = 0;
+        j0 = 0;
+        field  = f->data_;
+        stride = f->dims_[1];
+    }
+
+    #pragma omp simd
+    for (int ipart=0 ; ipart<npack ; ipart++) {
+        int iloc = (idx[ipart]-1-i0)*stride + idy[ipart]-1-j0;
+        double interp_res = 0.;
+        for (int i=0 ; i<3 ; i++) {
+            for (int j=0 ; j<3 ; j++) {
+                interp_res += coeffx[i*N+ipart] * coeffy[j*N+ipart] * field[iloc+i*stride+j];
+            }
+        }
+        out[ipart] = interp_res;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 2nd Order Interpolation of the fields at the positions of a pack of particles (3 nodes are used)
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator2D2OrderV::fields(ElectroMagn* EMfields, Particles &particles, int ipart, int npack, int nparts, double* ELoc, double* BLoc, int* iold, double* deltaold)
+{
+    const int N = vecto_size;
+
+    // Interpolation coefficients on Prim and Dual grids, stored as [node][particle]
+    double coeffxp[3*N], coeffyp[3*N], coeffxd[3*N], coeffyd[3*N];
+    // Indexes of the central nodes
+    int ip[N], id[N], jp[N], jd[N];
+
+    double* position_x = particles.getPtrPosition(0) + ipart;
+    double* position_y = particles.getPtrPosition(1) + ipart;
+
+    #pragma omp simd
+    for (int i=0 ; i<npack ; i++) {
+        // Normalized particle position
+        double xpn = position_x[i]*dx_inv_;
+        double ypn = position_y[i]*dy_inv_;
+
+        int ipn = round(xpn);
+        int idn = round(xpn+0.5);
+        int jpn = round(ypn);
+        int jdn = round(ypn+0.5);
+
+        coefficients( xpn - (double)idn + 0.5, coeffxd, N, i );
+        coefficients( xpn - (double)ipn      , coeffxp, N, i );
+        coefficients( ypn - (double)jdn + 0.5, coeffyd, N, i );
+        coefficients( ypn - (double)jpn      , coeffyp, N, i );
+        deltaold[       i] = xpn - (double)ipn;
+        deltaold[nparts+i] = ypn - (double)jpn;
+
+        // First index for summation
+        ip[i] = ipn - i_domain_begin;
+        id[i] = idn - i_domain_begin;
+        jp[i] = jpn - j_domain_begin;
+        jd[i] = jdn - j_domain_begin;
+        iold[       i] = ip[i];
+        iold[nparts+i] = jp[i];
+    }
+
+    // Ex^(d,p), Ey^(p,d), Ez^(p,p)
+    gather( static_cast<Field2D*>(EMfields->Ex_), coeffxd, coeffyp, id, jp, ELoc         , npack );
+    gather( static_cast<Field2D*>(EMfields->Ey_), coeffxp, coeffyd, ip, jd, ELoc+  nparts, npack );
+    gather( static_cast<Field2D*>(EMfields->Ez_), coeffxp, coeffyp, ip, jp, ELoc+2*nparts, npack );
+    // Bx^(p,d), By^(d,p), Bz^(d,d)
+    gather( static_cast<Field2D*>(EMfields->Bx_m), coeffxp, coeffyd, ip, jd, BLoc         , npack );
+    gather( static_cast<Field2D*>(EMfields->By_m), coeffxd, coeffyp, id, jp, BLoc+  nparts, npack );
+    gather( static_cast<Field2D*>(EMfields->Bz_m), coeffxd, coeffyd, id, jd, BLoc+2*nparts, npack );
+
+} // END Interpolator2D2OrderV
+
+void Interpolator2D2OrderV::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int *istart, int *iend, int ithread)
+{
+    std::vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
+    std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
+    std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
+
+    //Loop on the packs of the bin (thread buffers only hold the particles of the bin)
+    int nparts( *iend-*istart );
+    for (int ipack=*istart ; ipack<*iend; ipack+=vecto_size ) {
+        int npack = min( (int)vecto_size, *iend-ipack );
+        fields(EMfields, particles, ipack, npack, nparts, &(*Epart)[ipack-*istart], &(*Bpart)[ipack-*istart], &(*iold)[ipack-*istart], &(*delta)[ipack-*istart]);
+    }
+
+}
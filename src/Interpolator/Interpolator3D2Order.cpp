@@ -276,18 +276,18 @@ void Interpolator3D2Order::operator() (ElectroMagn* EMfields, Particles &particl
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
 
-    //Loop on bin particles
-    int nparts( particles.size() );
+    //Loop on bin particles (thread buffers only hold the particles of the bin)
+    int nparts( *iend-*istart );
     for (int ipart=*istart ; ipart<*iend; ipart++ ) {
         //Interpolation on current particle
-        (*this)(EMfields, particles, ipart, nparts, &(*Epart)[ipart], &(*Bpart)[ipart]);
+        (*this)(EMfields, particles, ipart, nparts, &(*Epart)[ipart-*istart], &(*Bpart)[ipart-*istart]);
         //Buffering of iol and delta
-        (*iold)[ipart+0*nparts]  = ip_;
-        (*iold)[ipart+1*nparts]  = jp_;
-        (*iold)[ipart+2*nparts]  = kp_;
-        (*delta)[ipart+0*nparts] = deltax;
-        (*delta)[ipart+1*nparts] = deltay;
-        (*delta)[ipart+2*nparts] = deltaz;
+        (*iold)[ipart-*istart+0*nparts]  = ip_;
+        (*iold)[ipart-*istart+1*nparts]  = jp_;
+        (*iold)[ipart-*istart+2*nparts]  = kp_;
+        (*delta)[ipart-*istart+0*nparts] = deltax;
+        (*delta)[ipart-*istart+1*nparts] = deltay;
+        (*delta)[ipart-*istart+2*nparts] = deltaz;
     }
 
 }
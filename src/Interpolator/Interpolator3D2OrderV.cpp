@@ -0,0 +1,168 @@
+#include "Interpolator3D2OrderV.h"
+
+#include <cmath>
+#include <iostream>
+
+#include "ElectroMagn.h"
+#include "Field3D.h"
+#include "Particles.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Creator for Interpolator3D2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Interpolator3D2OrderV::Interpolator3D2OrderV(Params &params, Patch *patch) : Interpolator3D2Order(params, patch)
+{
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 2nd order coefficients of the 3 nodes around the central node, for the particle i of a pack
+// ---------------------------------------------------------------------------------------------------------------------
+static inline void coefficients(double delta, double* coeff, int N, int i)
+{
+    double delta2 = delta*delta;
+    coeff[    i] = 0.5 * (delta2-delta+0.25);
+    coeff[  N+i] = 0.75 - delta2;
+    coeff[2*N+i] = 0.5 * (delta2+delta+0.25);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Gather the field f at the particles of a pack
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator3D2OrderV::gather(Field3D* f, double* coeffx, double* coeffy, double* coeffz, int* idx, int* idy, int* idz, double* out, int npack)
+{
+    const int N = vecto_size;
+    const int T = tile_size;
+
+    // Bounds of the stencils of the pack
+    int imin = idx[0], imax = idx[0], jmin = idy[0], jmax = idy[0], kmin = idz[0], kmax = idz[0];
+    for (int ipart=1 ; ipart<npack ; ipart++) {
+        imin = min( imin, idx[ipart] );
+        imax = max( imax, idx[ipart] );
+        jmin = min( jmin, idy[ipart] );
+        jmax = max( jmax, idy[ipart] );
+        kmin = min( kmin, idz[ipart] );
+        kmax = max( kmax, idz[ipart] );
+    }
+
+    double tile[T*T*T];
+    double* field;
+    int stride_y, stride_x, i0, j0, k0;
+    if ( imax-imin <= T-3 && jmax-jmin <= T-3 && kmax-kmin <= T-3 ) {
+        // Copy the tile covering the stencils of the pack
+        i0 = imin-1;
+        j0 = jmin-1;
+        k0 = kmin-1;
+        for (int i=0 ; i<imax-imin+3 ; i++)
+            for (int j=0 ; j<jmax-jmin+3 ; j++)
+                for (int k=0 ; k<kmax-kmin+3 ; k++)
+                    tile[(i*T+j)*T+k] = (*f)(i0+i, j0+j, k0+k);
+        field    = tile;
+        stride_y = T;
+        stride_x = T*T;
+    } else {
+        // Particles of the pack are too far apart: gather from the whole field
+        i0 = 0;
+        j0 = 0;
+        k0 = 0;
+        field    = f->data_;
+        stride_y = f->dims_[2];
+        stride_x = f->dims_[1]*f->dims_[2];
+    }
+
+    #pragma omp simd
+    for (int ipart=0 ; ipart<npack ; ipart++) {
+        int iloc = (idx[ipart]-1-i0)*stride_x + (idy[ipart]-1-j0)*stride_y + idz[ipart]-1-k0;
+        double interp_res = 0.;
+        for (int i=0 ; i<3 ; i++) {
+            for (int j=0 ; j<3 ; j++) {
+                double coeffxy = coeffx[i*N+ipart] * coeffy[j*N+ipart];
+                for (int k=0 ; k<3 ; k++) {
+                    interp_res += coeffxy * coeffz[k*N+ipart] * field[iloc+i*stride_x+j*stride_y+k];
+                }
+            }
+        }
+        out[ipart] = interp_res;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// 2nd Order Interpolation of the fields at the positions of a pack of particles (3 nodes are used)
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator3D2OrderV::fields(ElectroMagn* EMfields, Particles &particles, int ipart, int npack, int nparts, double* ELoc, double* BLoc, int* iold, double* deltaold)
+{
+    const int N = vecto_size;
+
+    // Interpolation coefficients on Prim and Dual grids, stored as [node][particle]
+    double coeffxp[3*N], coeffyp[3*N], coeffzp[3*N], coeffxd[3*N], coeffyd[3*N], coeffzd[3*N];
+    // Indexes of the central nodes
+    int ip[N], id[N], jp[N], jd[N], kp[N], kd[N];
+
+    double* position_x = particles.getPtrPosition(0) + ipart;
+    double* position_y = particles.getPtrPosition(1) + ipart;
+    double* position_z = particles.getPtrPosition(2) + ipart;
+
+    #pragma omp simd
+    for (int i=0 ; i<npack ; i++) {
+        // Normalized particle position
+        double xpn = position_x[i]*dx_inv_;
+        double ypn = position_y[i]*dy_inv_;
+        double zpn = position_z[i]*dz_inv_;
+
+        int ipn = round(xpn);
+        int idn = round(xpn+0.5);
+        int jpn = round(ypn);
+        int jdn = round(ypn+0.5);
+        int kpn = round(zpn);
+        int kdn = round(zpn+0.5);
+
+        coefficients( xpn - (double)idn + 0.5, coeffxd, N, i );
+        coefficients( xpn - (double)ipn      , coeffxp, N, i );
+        coefficients( ypn - (double)jdn + 0.5, coeffyd, N, i );
+        coefficients( ypn - (double)jpn      , coeffyp, N, i );
+        coefficients( zpn - (double)kdn + 0.5, coeffzd, N, i );
+        coefficients( zpn - (double)kpn      , coeffzp, N, i );
+        deltaold[         i] = xpn - (double)ipn;
+        deltaold[  nparts+i] = ypn - (double)jpn;
+        deltaold[2*nparts+i] = zpn - (double)kpn;
+
+        // First index for summation
+        ip[i] = ipn - i_domain_begin;
+        id[i] = idn - i_domain_begin;
+        jp[i] = jpn - j_domain_begin;
+        jd[i] = jdn - j_domain_begin;
+        kp[i] = kpn - k_domain_begin;
+        kd[i] = kdn - k_domain_begin;
+        iold[         i] = ip[i];
+        iold[  nparts+i] = jp[i];
+        iold[2*nparts+i] = kp[i];
+    }
+
+    // Ex^(d,p,p), Ey^(p,d,p), Ez^(p,p,d)
+    gather( static_cast<Field3D*>(EMfields->Ex_), coeffxd, coeffyp, coeffzp, id, jp, kp, ELoc         , npack );
+    gather( static_cast<Field3D*>(EMfields->Ey_), coeffxp, coeffyd, coeffzp, ip, jd, kp, ELoc+  nparts, npack );
+    gather( static_cast<Field3D*>(EMfields->Ez_), coeffxp, coeffyp, coeffzd, ip, jp, kd, ELoc+2*nparts, npack );
+    // Bx^(p,d,d), By^(d,p,d), Bz^(d,d,p)
+    gather( static_cast<Field3D*>(EMfields->Bx_m), coeffxp, coeffyd, coeffzd, ip, jd, kd, BLoc         , npack );
+    gather( static_cast<Field3D*>(EMfields->By_m), coeffxd, coeffyp, coeffzd, id, jp, kd, BLoc+  nparts, npack );
+    gather( static_cast<Field3D*>(EMfields->Bz_m), coeffxd, coeffyd, coeffzp, id, jd, kp, BLoc+2*nparts, npack );
+
+} // END Interpolator3D2OrderV
+
+void Interpolator3D2OrderV::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int *istart, int *iend, int ithread)
+{
+    std::vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
+    std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
+    std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
+
+    //Loop on the packs of the bin (thread buffers only hold the particles of the bin)
+    int nparts( *iend-*istart );
+    for (int ipack=*istart ; ipack<*iend; ipack+=vecto_size ) {
+        int npack = min( (int)vecto_size, *iend-ipack );
+        fields(EMfields, particles, ipack, npack, nparts, &(*Epart)[ipack-*istart], &(*Bpart)[ipack-*istart], &(*iold)[ipack-*istart], &(*delta)[ipack-*istart]);
+    }
+
+}
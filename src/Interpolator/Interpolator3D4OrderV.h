@@ -0,0 +1,38 @@
+#ifndef INTERPOLATOR3D4ORDERV_H
+#define INTERPOLATOR3D4ORDERV_H
+
+
+#include "Interpolator3D4Order.h"
+#include "Field3D.h"
+
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class for vectorized 4th order interpolator for 3Dcartesian simulations
+//! The particles of a bin are processed by packs of vecto_size: the coefficients are computed for the whole pack
+//! (one SIMD lane per particle), then each field is gathered from a local copy of the tile covering the pack.
+//  --------------------------------------------------------------------------------------------------------------------
+class Interpolator3D4OrderV : public Interpolator3D4Order
+{
+
+public:
+    Interpolator3D4OrderV(Params&, Patch*);
+    ~Interpolator3D4OrderV() override final {};
+
+    //! Interpolate E, B at the particles of the pack [ipart, ipart+npack)
+    void fields(ElectroMagn* EMfields, Particles &particles, int ipart, int npack, int nparts, double* ELoc, double* BLoc, int* iold, double* deltaold);
+    void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int *istart, int *iend, int ithread) override final ;
+
+    //! Number of particles in a pack
+    static const int vecto_size = 8;
+
+private:
+    //! Size of the local tile: 5-point stencils spread over at most 2 more cells in each direction
+    static const int tile_size = 7;
+
+    //! Interpolate the field f at the particles of the pack, from the coefficients coeffx/y/z ([5][vecto_size])
+    //! and the central nodes idx/idy/idz of each particle
+    void gather(Field3D* f, double* coeffx, double* coeffy, double* coeffz, int* idx, int* idy, int* idz, double* out, int npack);
+
+};//END class
+
+#endif
@@ -10,10 +10,10 @@
 #include "Interpolator3D2Order.h"
 #include "Interpolator3D4Order.h"
 
-#ifdef _VECTO
 #include "Interpolator2D2OrderV.h"
+#include "Interpolator2D4OrderV.h"
 #include "Interpolator3D2OrderV.h"
-#endif
+#include "Interpolator3D4OrderV.h"
 
 #include "Params.h"
 #include "Patch.h"
@@ -39,13 +39,14 @@ public:
         else if ( ( params.geometry == "2Dcartesian" ) && ( params.interpolation_order == 2 ) ) {
             if (!params.vecto)
                 Interp = new Interpolator2D2Order(params, patch);
-#ifdef _VECTO
             else
                 Interp = new Interpolator2D2OrderV(params, patch);
-#endif
         }
         else if ( ( params.geometry == "2Dcartesian" ) && ( params.interpolation_order == 4 ) ) {
-            Interp = new Interpolator2D4Order(params, patch);
+            if (!params.vecto)
+                Interp = new Interpolator2D4Order(params, patch);
+            else
+                Interp = new Interpolator2D4OrderV(params, patch);
         }
         // ---------------
         // 3Dcartesian simulation
@@ -53,13 +54,14 @@ public:
         else if ( ( params.geometry == "3Dcartesian" ) && ( params.interpolation_order == 2 ) ) {
             if (!params.vecto)
                 Interp = new Interpolator3D2Order(params, patch);
-#ifdef _VECTO
             else
                 Interp = new Interpolator3D2OrderV(params, patch);
-#endif
         }
         else if ( ( params.geometry == "3Dcartesian" ) && ( params.interpolation_order == 4 ) ) {
-            Interp = new Interpolator3D4Order(params, patch);
+            if (!params.vecto)
+                Interp = new Interpolator3D4Order(params, patch);
+            else
+                Interp = new Interpolator3D4OrderV(params, patch);
         }
         else {
             ERROR( "Unknwon parameters : " << params.geometry << ", Order : " << params.interpolation_order );
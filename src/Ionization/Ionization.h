@@ -8,6 +8,7 @@
 #include "Field.h"
 #include "Particles.h"
 #include "Projector.h"
+#include "Random.h"
 
 
 //! Class Ionization: generic class allowing to define Ionization physics
@@ -37,6 +38,12 @@ protected:
     unsigned int nDim_field;
     unsigned int nDim_particle;
     double ionized_species_invmass;
+    
+    //! Random number generator of the ionized species
+    Random * rand_;
+    
+    //! Random numbers drawn at once for all the particles of a bin
+    std::vector<double> random_numbers;
 
 private:
 
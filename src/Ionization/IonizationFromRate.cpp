@@ -54,7 +54,10 @@ void IonizationFromRate::operator() (Particles* particles, unsigned int ipart_mi
         Py_DECREF(ret);
     }
 #endif
-
+    
+    // One random number per particle of the bin, drawn at once
+    random_numbers.resize( ipart_max - ipart_min );
+    rand_->uniform( random_numbers.data(), ipart_max - ipart_min );
     
     for( unsigned int ipart=ipart_min ; ipart<ipart_max; ipart++ ) {
         
@@ -67,7 +70,7 @@ void IonizationFromRate::operator() (Particles* particles, unsigned int ipart_mi
         // Start of the Monte-Carlo routine  (At the moment, only 1 ionization per timestep is possible)
         // k_times will give the nb of ionization events
         k_times = 0;
-        double ran_p = Rand::uniform();
+        double ran_p = random_numbers[ipart-ipart_min];
         if ( ran_p < 1.0 - exp(-rate[ipart-ipart_min]*dt) ) {
             k_times        = 1;
         }
@@ -55,11 +55,15 @@ void IonizationTunnel::operator() (Particles* particles, unsigned int ipart_min,
     LocalFields Jion;
     double factorJion_0 = au_to_mec2 * EC_to_au*EC_to_au * invdt;
     
-    int nparts = particles->size();
+    int nparts = ipart_max-ipart_min;
     double* Ex = &( (*Epart)[0*nparts] );
     double* Ey = &( (*Epart)[1*nparts] );
     double* Ez = &( (*Epart)[2*nparts] );
     
+    // One random number per particle of the bin, drawn at once
+    random_numbers.resize( nparts );
+    rand_->uniform( random_numbers.data(), nparts );
+    
     for( unsigned int ipart=ipart_min ; ipart<ipart_max; ipart++ ) {
         
         // Current charge state of the ion
@@ -69,9 +73,9 @@ void IonizationTunnel::operator() (Particles* particles, unsigned int ipart_min,
         if (Z==atomic_number_) continue;
         
         // Absolute value of the electric field normalized in atomic units
-        E = EC_to_au * sqrt( pow(*(Ex+ipart),2)
-                            +pow(*(Ey+ipart),2) 
-                            +pow(*(Ez+ipart),2) );
+        E = EC_to_au * sqrt( pow(*(Ex+ipart-ipart_min),2)
+                            +pow(*(Ey+ipart-ipart_min),2) 
+                            +pow(*(Ez+ipart-ipart_min),2) );
         if (E<1e-10) continue;
         
         // --------------------------------
@@ -81,7 +85,7 @@ void IonizationTunnel::operator() (Particles* particles, unsigned int ipart_min,
         invE = 1./E;
         factorJion = factorJion_0 * invE*invE;
         delta      = gamma_tunnel[Z]*invE;
-        ran_p = Rand::uniform();
+        ran_p = random_numbers[ipart-ipart_min];
         IonizRate_tunnel[Z] = beta_tunnel[Z] * exp( -delta*one_third + alpha_tunnel[Z]*log(delta));
         
         // Total ionization potential (used to compute the ionization current)
@@ -140,9 +144,9 @@ void IonizationTunnel::operator() (Particles* particles, unsigned int ipart_min,
         
         // Compute ionization current
         factorJion *= TotalIonizPot;
-        Jion.x = factorJion * *(Ex+ipart);
-        Jion.y = factorJion * *(Ey+ipart);
-        Jion.z = factorJion * *(Ez+ipart);
+        Jion.x = factorJion * *(Ex+ipart-ipart_min);
+        Jion.y = factorJion * *(Ey+ipart-ipart_min);
+        Jion.z = factorJion * *(Ez+ipart-ipart_min);
         
         (*Proj)(EMfields->Jx_, EMfields->Jy_, EMfields->Jz_, *particles, ipart, Jion);
         
@@ -41,6 +41,9 @@ MultiphotonBreitWheeler::MultiphotonBreitWheeler(Params& params, Species * speci
     //! Threshold under which pair creation is not considered
     chiph_threashold = 1E-2;
 
+    // Random number generator of the species
+    rand_ = &(species->random);
+
 }
 
 // -----------------------------------------------------------------------------
@@ -84,7 +87,7 @@ void MultiphotonBreitWheeler::compute_thread_chiph(Particles &particles,
     // _______________________________________________________________
     // Computation
 
-    int nparts = particles.size();
+    int nparts = iend-istart;
     double* Ex = &( (*Epart)[0*nparts] );
     double* Ey = &( (*Epart)[1*nparts] );
     double* Ez = &( (*Epart)[2*nparts] );
@@ -105,8 +108,8 @@ void MultiphotonBreitWheeler::compute_thread_chiph(Particles &particles,
         chi[ipart] = compute_chiph(
                  momentum[0][ipart],momentum[1][ipart],momentum[2][ipart],
                  gamma,
-                 (*(Ex+ipart)),(*(Ey+ipart)),(*(Ez+ipart)),
-                 (*(Bx+ipart)),(*(By+ipart)),(*(Bz+ipart)) );
+                 (*(Ex+ipart-istart)),(*(Ey+ipart-istart)),(*(Ez+ipart-istart)),
+                 (*(Bx+ipart-istart)),(*(By+ipart-istart)),(*(Bz+ipart-istart)) );
 
     }
 }
@@ -137,7 +140,7 @@ void MultiphotonBreitWheeler::operator() (Particles &particles,
     // We use dynamics_invgf to store gamma
     std::vector<double> * gamma = &(smpi->dynamics_invgf[ithread]);
 
-    int nparts = particles.size();
+    int nparts = iend-istart;
     double* Ex = &( (*Epart)[0*nparts] );
     double* Ey = &( (*Epart)[1*nparts] );
     double* Ez = &( (*Epart)[2*nparts] );
@@ -185,16 +188,16 @@ void MultiphotonBreitWheeler::operator() (Particles &particles,
     for (int ipart=istart ; ipart<iend; ipart++ )
     {
         // Gamma
-        (*gamma)[ipart] = sqrt(momentum[0][ipart]*momentum[0][ipart]
+        (*gamma)[ipart-istart] = sqrt(momentum[0][ipart]*momentum[0][ipart]
                     + momentum[1][ipart]*momentum[1][ipart]
                     + momentum[2][ipart]*momentum[2][ipart]);
 
         // Computation of the Lorentz invariant quantum parameter
         chiph[ipart] = MultiphotonBreitWheeler::compute_chiph(
                  momentum[0][ipart],momentum[1][ipart],momentum[2][ipart],
-                 (*gamma)[ipart],
-                 (*(Ex+ipart)),(*(Ey+ipart)),(*(Ez+ipart)),
-                 (*(Bx+ipart)),(*(By+ipart)),(*(Bz+ipart)) );
+                 (*gamma)[ipart-istart],
+                 (*(Ex+ipart-istart)),(*(Ey+ipart-istart)),(*(Ez+ipart-istart)),
+                 (*(Bx+ipart-istart)),(*(By+ipart-istart)),(*(Bz+ipart-istart)) );
     }
 
     // 2. Monte-Carlo process
@@ -205,7 +208,7 @@ void MultiphotonBreitWheeler::operator() (Particles &particles,
         // If the photon has enough energy
         // We also check that chiph > chiph_threshold,
         // else chiph is too low to induce a decay
-        if (((*gamma)[ipart] > 2.) && (chiph[ipart] > chiph_threashold))
+        if (((*gamma)[ipart-istart] > 2.) && (chiph[ipart] > chiph_threashold))
         {
             // Init local variables
             event_time = 0;
@@ -216,7 +219,7 @@ void MultiphotonBreitWheeler::operator() (Particles &particles,
             {
              // New final optical depth to reach for emision
              while (tau[ipart] <= epsilon_tau)
-                tau[ipart] = -log(1.-Rand::uniform());
+                tau[ipart] = -log(1.-rand_->uniform());
 
             }
 
@@ -225,7 +228,7 @@ void MultiphotonBreitWheeler::operator() (Particles &particles,
             else if (tau[ipart] > epsilon_tau)
             {
                 // from the cross section
-                temp = MultiphotonBreitWheelerTables.compute_dNBWdt(chiph[ipart],(*gamma)[ipart]);
+                temp = MultiphotonBreitWheelerTables.compute_dNBWdt(chiph[ipart],(*gamma)[ipart-istart]);
 
                 // Time to decay
                 // If this time is above the remaining iteration time,
@@ -255,7 +258,7 @@ void MultiphotonBreitWheeler::operator() (Particles &particles,
                     // Generation of the pairs
                    MultiphotonBreitWheeler::pair_emission(ipart,
                                           particles,
-                                          (*gamma)[ipart],
+                                          (*gamma)[ipart-istart],
                                           dt - event_time,
                                           MultiphotonBreitWheelerTables);
 
@@ -303,7 +306,7 @@ void MultiphotonBreitWheeler::pair_emission(int ipart,
     inv_chiph_gammaph = (gammaph-2.)/particles.chi(ipart);
 
     // Get the pair quantum parameters to compute the energy
-    chi = MultiphotonBreitWheelerTables.compute_pair_chi( particles.chi(ipart));
+    chi = MultiphotonBreitWheelerTables.compute_pair_chi( particles.chi(ipart), rand_ );
 
     // pair propagation direction // direction of the photon
     for (k = 0 ; k<3 ; k++ ) {
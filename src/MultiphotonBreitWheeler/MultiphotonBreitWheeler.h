@@ -142,6 +142,9 @@ class MultiphotonBreitWheeler
         //! Threshold under which pair creation is not considered
         double chiph_threashold;
 
+        //! Random number generator of the photon species
+        Random * rand_;
+
         // _________________________________________
         // Factors
 
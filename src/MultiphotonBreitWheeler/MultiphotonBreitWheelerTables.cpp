@@ -253,8 +253,9 @@ double MultiphotonBreitWheelerTables::compute_integration_Ritus_dTdchi(double ch
 //! the multiphoton Breit-Wheeler pair creation
 //
 //! \param chiph photon quantum parameter
+//! \param rand random number generator
 // -----------------------------------------------------------------------------
-double * MultiphotonBreitWheelerTables::compute_pair_chi(double chiph)
+double * MultiphotonBreitWheelerTables::compute_pair_chi(double chiph, Random * rand)
 {
     // Parameters
     double * chi = new double[2];
@@ -295,7 +296,7 @@ double * MultiphotonBreitWheelerTables::compute_pair_chi(double chiph)
     // ---------------------------------------
 
     // First, we compute a random xip in [0,1[
-    xip = Rand::uniform();
+    xip = rand->uniform();
 
     // The array uses the symmetric properties of the T fonction,
     // Cases xip > or <= 0.5 are treated seperatly
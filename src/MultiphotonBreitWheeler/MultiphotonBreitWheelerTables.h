@@ -20,6 +20,7 @@
 
 #include "Params.h"
 #include "H5.h"
+#include "Random.h"
 #include "userFunctions.h"
 
 //------------------------------------------------------------------------------
@@ -80,7 +81,8 @@ class MultiphotonBreitWheelerTables
         //! Computation of the electron and positron quantum parameters for
         //! the multiphoton Breit-Wheeler pair creation
         //! \param chiph photon quantum parameter
-        double * compute_pair_chi(double chiph);
+        //! \param rand random number generator
+        double * compute_pair_chi(double chiph, Random * rand);
 
         // ---------------------------------------------------------------------
         // TABLE COMPUTATION
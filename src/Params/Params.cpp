@@ -2,6 +2,7 @@
 #include <cmath>
 #include <ctime>
 #include <iomanip>
+#include <random>
 
 #define SMILEI_IMPORT_ARRAY
 
@@ -18,31 +19,6 @@
 
 using namespace std;
 
-namespace Rand
-{
-    std::random_device device;
-    std::mt19937 gen(device());
-
-    std::uniform_real_distribution<double> uniform_distribution(0., 1.);
-    double uniform() {
-        return uniform_distribution(gen);
-    }
-
-    std::uniform_real_distribution<double> uniform_distribution1(0., 1.-1e-11);
-    double uniform1() {
-        return uniform_distribution1(gen);
-    }
-
-    std::uniform_real_distribution<double> uniform_distribution2(-1., 1.);
-    double uniform2() {
-        return uniform_distribution2(gen);
-    }
-    double normal(double stddev) {
-        std::normal_distribution<double> normal_distribution(0., stddev);
-        return normal_distribution(gen);
-    }
-}
-
 #define DO_EXPAND(VAL)  VAL ## 1
 #define EXPAND(VAL)     DO_EXPAND(VAL)
 #ifdef SMILEI_USE_NUMPY
@@ -178,13 +154,13 @@ namelist("")
     }
 
     // random seed
-    unsigned int random_seed=0;
-    if (PyTools::extract("random_seed", random_seed, "Main")) {
-        // Init of the seed for the vectorized C++ random generator recommended by Intel
-        // See https://software.intel.com/en-us/articles/random-number-function-vectorization
-        srand48(random_seed);
-        // Init of the seed for the C++ random generator
-        Rand::gen = std::mt19937(random_seed);
+    // If not provided, it is drawn by the master and shared, because the patch
+    // generators (see Random.h) must have the same key on all processes
+    random_seed=0;
+    if (!PyTools::extract("random_seed", random_seed, "Main")) {
+        int seed = (int)( std::random_device()() >> 1 );
+        smpi->bcast( seed );
+        random_seed = (unsigned int) seed;
     }
 
     // communication pattern initialized as partial B exchange
@@ -454,8 +430,14 @@ namelist("")
         PyTools::extract("cell_load"  , cell_load      , "LoadBalancing");
         PyTools::extract("frozen_particle_load", frozen_particle_load    , "LoadBalancing");
         PyTools::extract("initial_balance", initial_balance    , "LoadBalancing");
+        PyTools::extract("measured_load", measured_load    , "LoadBalancing");
+        PyTools::extract("load_smoothing", load_smoothing    , "LoadBalancing");
+        if( load_smoothing <= 0. || load_smoothing > 1. )
+            ERROR("LoadBalancing: load_smoothing must be in ]0,1]");
     } else {
         load_balancing_time_selection = new TimeSelection();
+        measured_load  = false;
+        load_smoothing = 0.5;
     }
 
     has_load_balancing = (smpi->getSize()>1)  && (! load_balancing_time_selection->isEmpty());
@@ -475,7 +457,22 @@ namelist("")
     PyTools::extract("vecto", vecto, "Main");
     if (vecto)
         MESSAGE( "Apply vectorization" );
+
+    // Sorting of the particles by cell
+    PyTools::extract("cell_sorting", cell_sorting, "Main");
+    PyTools::extract("cell_sorting_every", cell_sorting_every, "Main");
+    if (cell_sorting_every < 1)
+        ERROR("cell_sorting_every must be at least 1");
+    // The vectorized projectors process packs of particles located in the same few cells
+    if (vecto && !cell_sorting) {
+        cell_sorting = true;
+        WARNING("cell_sorting has been set to True, as required by vecto");
+    }
     
+    // Synchronization of the fields between MPI processes
+    PyTools::extract("aggregate_field_exchange", aggregate_field_exchange, "Main");
+    PyTools::extract("aggregate_particle_exchange", aggregate_particle_exchange, "Main");
+
     // Read the "print_every" parameter
     print_every = (int)(simulation_time/timestep)/10;
     PyTools::extract("print_every", print_every, "Main");
@@ -730,6 +727,8 @@ void Params::print_init()
         MESSAGE(1,"Happens: " << load_balancing_time_selection->info());
         MESSAGE(1,"Cell load coefficient = " << cell_load );
         MESSAGE(1,"Frozen particle load coefficient = " << frozen_particle_load );
+        if (measured_load)
+            MESSAGE(1,"Patch loads measured with timers (smoothing = " << load_smoothing << ")" );
     }
 }
 
@@ -26,29 +26,10 @@
 #include <ostream>
 #include <algorithm>
 #include <iterator>
-#include <random>
 
 class SmileiMPI;
 class Species;
 
-namespace Rand
-{
-    extern std::random_device device;
-    extern std::mt19937 gen;
-
-    extern std::uniform_real_distribution<double> uniform_distribution;
-    extern double uniform();
-
-    extern std::uniform_real_distribution<double> uniform_distribution1;
-    extern double uniform1();
-
-    extern std::uniform_real_distribution<double> uniform_distribution2;
-    extern double uniform2();
-
-    extern std::normal_distribution<double> normal_distribution;
-    extern double normal(double stddev);
-}
-
 
 // ---------------------------------------------------------------------------------------------------------------------
 //! Params class: holds all the properties of the simulation that are read from the input file
@@ -140,6 +121,12 @@ public:
     //! Do we need to exchange full B (default=0 <=> only 2 components are exchanged by dimension)
     bool full_B_exchange;
 
+    //! Synchronize the fields with one MPI message per neighbor process (instead of one per patch and per field)
+    bool aggregate_field_exchange;
+
+    //! Exchange the particles with one MPI message per neighbor process (instead of one per patch)
+    bool aggregate_particle_exchange;
+
     //! Maxwell Solver (default='Yee')
     std::string maxwell_sol;
     
@@ -194,6 +181,9 @@ public:
     //! True if restart requested
     bool restart;
 
+    //! Seed of the random number generators (same on all MPI processes)
+    unsigned int random_seed;
+
     //! frequency of exchange particles (default = 1, disabled for now, incompatible with sort)
     int exchange_particles_each;
     
@@ -217,6 +207,10 @@ public:
     double cell_load;
     //! Load coefficient applied to a frozen particle (default = 0.1)
     double frozen_particle_load;
+    //! True if the load of patches is measured with timers instead of being estimated from particle counts
+    bool measured_load;
+    //! Weight of the last measurement in the exponential smoothing of the measured load (default = 0.5)
+    double load_smoothing;
     //! Return if number of patch = number of MPI process, to tune IO //ism
     bool one_patch_per_MPI;
     //! Compute an initially balanced patch distribution right from the start
@@ -224,6 +218,11 @@ public:
 
     bool vecto;
 
+    //! Sort the particles by cell inside each cluster before the particle dynamics
+    bool cell_sorting;
+    //! Number of timesteps between two sortings by cell
+    unsigned int cell_sorting_every;
+
     //! Tells whether there is a moving window
     bool hasWindow;
 
@@ -45,6 +45,8 @@ Patch::Patch(Params& params, SmileiMPI* smpi, DomainDecomposition* domain_decomp
 
     hindex = ipatch;
     nDim_fields_ = params.nDim_field;
+    measured_load = -1.;
+    measured_steps = 0;
 
     initStep1(params);
 
@@ -58,6 +60,8 @@ Patch::Patch(Patch* patch, Params& params, SmileiMPI* smpi, DomainDecomposition*
     
     hindex = ipatch;
     nDim_fields_ = patch->nDim_fields_;
+    measured_load = -1.;
+    measured_steps = 0;
 
     initStep1(params);
 
@@ -440,6 +444,8 @@ void Patch::initExchParticles(SmileiMPI* smpi, int ispec, Params& params)
 void Patch::initCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch * vecPatch)
 {
     int h0 = (*vecPatch)(0)->hindex;
+    // If aggregated, inter-MPI process communications are managed by AggregatedSpeciesMPIbuffers
+    bool aggregated = ( vecPatch->aggregatedSpecies_.size() > 0 );
     /********************************************************************************/
     // Exchange number of particles to exchange to establish or not a communication
     /********************************************************************************/
@@ -449,8 +455,10 @@ void Patch::initCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iD
 
             if (is_a_MPI_neighbor(iDim, iNeighbor)) {
                 //If neighbour is MPI ==> I send him the number of particles I'll send later.
-                int tag = buildtag( hindex, iDim+1, iNeighbor+3 );
-                      MPI_Isend( &(vecSpecies[ispec]->MPIbuff.part_index_send_sz[iDim][iNeighbor]), 1, MPI_INT, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]) );
+                if (!aggregated) {
+                    int tag = buildtag( hindex, iDim+1, iNeighbor+3 );
+                    MPI_Isend( &(vecSpecies[ispec]->MPIbuff.part_index_send_sz[iDim][iNeighbor]), 1, MPI_INT, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]) );
+                }
             }
             else {
                 //Else, I directly set the receive size to the correct value.
@@ -459,7 +467,7 @@ void Patch::initCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iD
         } // END of Send
 
         if (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) {
-            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2)) {
+            if ( (!aggregated) && is_a_MPI_neighbor(iDim, (iNeighbor+1)%2) ) {
                 //If other neighbour is MPI ==> I receive the number of particles I'll receive later.
                 int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim+1, iNeighbor+3 );
                 MPI_Irecv( &(vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2]), 1, MPI_INT, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
@@ -482,11 +490,13 @@ void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim,
     int n_part_send, n_part_recv;
     int h0 = (*vecPatch)(0)->hindex;
     double x_max = params.cell_length[iDim]*( params.n_space_global[iDim] );
+    // If aggregated, the MPI particles are packed and sent by AggregatedSpeciesMPIbuffers after the periodicity is applied
+    bool aggregated = ( vecPatch->aggregatedSpecies_.size() > 0 );
 
     /********************************************************************************/
     // Wait for end of communications over number of particles
     /********************************************************************************/
-    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
+    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ && !aggregated ; iNeighbor++) {
         MPI_Status sstat    [2];
         MPI_Status rstat    [2];
         if (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) {
@@ -526,7 +536,7 @@ void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim,
                 }
             }
             // Send particles
-            if (is_a_MPI_neighbor(iDim, iNeighbor)) {
+            if ( (!aggregated) && is_a_MPI_neighbor(iDim, iNeighbor) ) {
                 // If MPI comm, first copy particles in the sendbuffer
                 for (int iPart=0 ; iPart<n_part_send ; iPart++)
                     cuParticles.cp_particle(vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor][iPart], vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor]);
@@ -535,7 +545,7 @@ void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim,
                 vecSpecies[ispec]->typePartSend[(iDim*2)+iNeighbor] = smpi->createMPIparticles( &(vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor]) );
                 MPI_Isend( &((vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor]).position(0,0)), 1, vecSpecies[ispec]->typePartSend[(iDim*2)+iNeighbor], MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]) );
             }
-            else {
+            else if (!is_a_MPI_neighbor(iDim, iNeighbor)) {
                 //If not MPI comm, copy particles directly in the receive buffer
                 for (int iPart=0 ; iPart<n_part_send ; iPart++)
                     cuParticles.cp_particle( vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor][iPart],((*vecPatch)( neighbor_[iDim][iNeighbor]- h0 )->vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]) );
@@ -544,7 +554,7 @@ void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim,
 
         n_part_recv = vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2];
         if ( (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
-            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2)) {
+            if ( (!aggregated) && is_a_MPI_neighbor(iDim, (iNeighbor+1)%2) ) {
                 // If MPI comm, receive particles in the recv buffer previously initialized.
                 vecSpecies[ispec]->typePartRecv[(iDim*2)+iNeighbor] = smpi->createMPIparticles( &(vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]) );
                 int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim+1 ,iNeighbor+3 );
@@ -574,6 +584,8 @@ void Patch::finalizeCommParticles(SmileiMPI* smpi, int ispec, Params& params, in
     Particles &cuParticles = (*vecSpecies[ispec]->particles);
 
     int n_part_send, n_part_recv;
+    // If aggregated, the MPI particles are already in partRecv
+    bool aggregated = ( vecPatch->aggregatedSpecies_.size() > 0 );
 
     /********************************************************************************/
     // Wait for end of communications over Particles
@@ -588,13 +600,13 @@ void Patch::finalizeCommParticles(SmileiMPI* smpi, int ispec, Params& params, in
 
 
         if ( (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) && (n_part_send!=0) ) {
-            if (is_a_MPI_neighbor(iDim, iNeighbor)) {
+            if ( (!aggregated) && is_a_MPI_neighbor(iDim, iNeighbor) ) {
                 MPI_Wait( &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]), &(sstat[iNeighbor]) );
                 MPI_Type_free( &(vecSpecies[ispec]->typePartSend[(iDim*2)+iNeighbor]) );
             }
         }
         if ( (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
-            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2)) {
+            if ( (!aggregated) && is_a_MPI_neighbor(iDim, (iNeighbor+1)%2) ) {
                 MPI_Wait( &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]), &(rstat[(iNeighbor+1)%2]) );
                 MPI_Type_free( &(vecSpecies[ispec]->typePartRecv[(iDim*2)+iNeighbor]) );
             }
@@ -29,6 +29,8 @@ class Patch
     friend class SimWindow;
     friend class SyncVectorPatch;
     friend class AsyncMPIbuffers;
+    friend class AggregatedMPIbuffers;
+    friend class AggregatedSpeciesMPIbuffers;
 public:
     //! Constructor for Patch
     Patch(Params& params, SmileiMPI* smpi, DomainDecomposition* domain_decomposition, unsigned int ipatch, unsigned int n_moved);
@@ -75,6 +77,11 @@ public:
     //! "fake" particles for the probe diagnostics
     std::vector<ProbeParticles*> probes;
 
+    //! Smoothed measured load of the patch, in units of the load of a particle (negative if not measured yet)
+    double measured_load;
+    //! Number of timesteps of this patch measured since the last load balancing
+    unsigned int measured_steps;
+
 
     // Geometrical description
     // -----------------------
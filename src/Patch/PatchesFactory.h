@@ -114,6 +114,10 @@ public:
         vecPatches.set_refHindex();
 
         vecPatches.update_field_list();
+        if( params.aggregate_field_exchange && !smpi->test_mode )
+            vecPatches.createAggregatedMPIbuffers( smpi );
+        if( params.aggregate_particle_exchange && !smpi->test_mode )
+            vecPatches.createAggregatedSpeciesMPIbuffers( smpi );
 
         TITLE("Creating Diagnostics, antennas, and external fields")
         vecPatches.createDiags( params, smpi, openPMD );
@@ -28,6 +28,8 @@ void SyncVectorPatch::exchangeParticles(VectorPatch& vecPatches, int ispec, Para
         for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
             vecPatches(ipatch)->initCommParticles(smpi, ispec, params, iDim, &vecPatches);
         }
+        if (vecPatches.aggregatedSpecies_.size()>0)
+            vecPatches.aggregatedSpecies_[ispec]->initCounts( vecPatches, iDim );
 
         //#pragma omp for schedule(runtime)
         //for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
@@ -47,10 +49,21 @@ void SyncVectorPatch::exchangeParticles(VectorPatch& vecPatches, int ispec, Para
 
 void SyncVectorPatch::finalize_and_sort_parts(VectorPatch& vecPatches, int ispec, Params &params, SmileiMPI* smpi, Timers &timers, int itime)
 {
+    // Inter-MPI process particles are packed in one message per neighbor MPI process, after CommParticles applied the periodicity
+    AggregatedSpeciesMPIbuffers* aggregated = NULL;
+    if (vecPatches.aggregatedSpecies_.size()>0)
+        aggregated = vecPatches.aggregatedSpecies_[ispec];
+
+    if (aggregated)
+        aggregated->finalizeCounts( vecPatches, 0 );
     #pragma omp for schedule(runtime)
     for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
         vecPatches(ipatch)->CommParticles(smpi, ispec, params, 0, &vecPatches);
     }
+    if (aggregated) {
+        aggregated->initParticles( vecPatches, 0 );
+        aggregated->finalizeParticles( vecPatches, 0 );
+    }
     #pragma omp for schedule(runtime)
     for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
         vecPatches(ipatch)->finalizeCommParticles(smpi, ispec, params, 0, &vecPatches);
@@ -62,11 +75,19 @@ void SyncVectorPatch::finalize_and_sort_parts(VectorPatch& vecPatches, int ispec
         for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
             vecPatches(ipatch)->initCommParticles(smpi, ispec, params, iDim, &vecPatches);
         }
+        if (aggregated) {
+            aggregated->initCounts( vecPatches, iDim );
+            aggregated->finalizeCounts( vecPatches, iDim );
+        }
 
         #pragma omp for schedule(runtime)
         for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
             vecPatches(ipatch)->CommParticles(smpi, ispec, params, iDim, &vecPatches);
         }
+        if (aggregated) {
+            aggregated->initParticles( vecPatches, iDim );
+            aggregated->finalizeParticles( vecPatches, iDim );
+        }
         #pragma omp for schedule(runtime)
         for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
             vecPatches(ipatch)->finalizeCommParticles(smpi, ispec, params, iDim, &vecPatches);
@@ -159,10 +180,14 @@ void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches,
     // Sum per direction :
 
     // iDim = 0, initialize comms : Isend/Irecv
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++) {
-        unsigned int ipatch = ifield%nPatches;
-        vecPatches(ipatch)->initSumField( fields[ifield], 0 );
+    if (vecPatches.aggregatedSum_)
+        vecPatches.aggregatedSum_->initSumField( fields, vecPatches, 0 );
+    else {
+        #pragma omp for schedule(static)
+        for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++) {
+            unsigned int ipatch = ifield%nPatches;
+            vecPatches(ipatch)->initSumField( fields[ifield], 0 );
+        }
     }
 
     //#pragma omp for schedule(static)
@@ -198,10 +223,14 @@ void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches,
     }
 
     // iDim = 0, finalize (waitall)
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++){
-        unsigned int ipatch = ifield%nPatches;
-        vecPatches(ipatch)->finalizeSumField( fields[ifield], 0 );
+    if (vecPatches.aggregatedSum_)
+        vecPatches.aggregatedSum_->finalizeSumField( fields, vecPatches, 0 );
+    else {
+        #pragma omp for schedule(static)
+        for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++){
+            unsigned int ipatch = ifield%nPatches;
+            vecPatches(ipatch)->finalizeSumField( fields[ifield], 0 );
+        }
     }
     // END iDim = 0 sync
     // -----------------
@@ -211,10 +240,14 @@ void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches,
         // Sum per direction :
 
         // iDim = 1, initialize comms : Isend/Irecv
-        #pragma omp for schedule(static)
-        for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++) {
-            unsigned int ipatch = ifield%nPatches;
-            vecPatches(ipatch)->initSumField( fields[ifield], 1 );
+        if (vecPatches.aggregatedSum_)
+            vecPatches.aggregatedSum_->initSumField( fields, vecPatches, 1 );
+        else {
+            #pragma omp for schedule(static)
+            for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++) {
+                unsigned int ipatch = ifield%nPatches;
+                vecPatches(ipatch)->initSumField( fields[ifield], 1 );
+            }
         }
 
         //#pragma omp for schedule(static)
@@ -254,10 +287,14 @@ void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches,
         }
 
         // iDim = 1, finalize (waitall)
-        #pragma omp for schedule(static)
-        for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++){
-            unsigned int ipatch = ifield%nPatches;
-            vecPatches(ipatch)->finalizeSumField( fields[ifield], 1 );
+        if (vecPatches.aggregatedSum_)
+            vecPatches.aggregatedSum_->finalizeSumField( fields, vecPatches, 1 );
+        else {
+            #pragma omp for schedule(static)
+            for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++){
+                unsigned int ipatch = ifield%nPatches;
+                vecPatches(ipatch)->finalizeSumField( fields[ifield], 1 );
+            }
         }
         // END iDim = 1 sync
         // -----------------
@@ -267,10 +304,14 @@ void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches,
             // Sum per direction :
 
             // iDim = 2, initialize comms : Isend/Irecv
-            #pragma omp for schedule(static)
-            for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++) {
-                unsigned int ipatch = ifield%nPatches;
-                vecPatches(ipatch)->initSumField( fields[ifield], 2 );
+            if (vecPatches.aggregatedSum_)
+                vecPatches.aggregatedSum_->initSumField( fields, vecPatches, 2 );
+            else {
+                #pragma omp for schedule(static)
+                for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++) {
+                    unsigned int ipatch = ifield%nPatches;
+                    vecPatches(ipatch)->initSumField( fields[ifield], 2 );
+                }
             }
 
             // iDim = 2 local
@@ -306,10 +347,14 @@ void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches,
             }
 
             // iDim = 2, complete non local sync through MPIfinalize (waitall)
-            #pragma omp for schedule(static)
-            for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++){
-                unsigned int ipatch = ifield%nPatches;
-                vecPatches(ipatch)->finalizeSumField( fields[ifield], 2 );
+            if (vecPatches.aggregatedSum_)
+                vecPatches.aggregatedSum_->finalizeSumField( fields, vecPatches, 2 );
+            else {
+                #pragma omp for schedule(static)
+                for (unsigned int ifield=0 ; ifield<fields.size() ; ifield++){
+                    unsigned int ipatch = ifield%nPatches;
+                    vecPatches(ipatch)->finalizeSumField( fields[ifield], 2 );
+                }
             }
             // END iDim = 2 sync
             // -----------------
@@ -353,12 +398,16 @@ void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPat
 
     // iDim = 0, initialize comms : Isend/Irecv
     unsigned int nPatchMPIx = vecPatches.MPIxIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIx[ifield             ], 0 ); // Jx
-        vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIx[ifield+  nPatchMPIx], 0 ); // Jy
-        vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0 ); // Jz
+    if (vecPatches.aggregatedSumJ_)
+        vecPatches.aggregatedSumJ_->initSumField( fields, vecPatches, 0 );
+    else {
+        #pragma omp for schedule(static)
+        for (unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++) {
+            unsigned int ipatch = vecPatches.MPIxIdx[ifield];
+            vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIx[ifield             ], 0 ); // Jx
+            vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIx[ifield+  nPatchMPIx], 0 ); // Jy
+            vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0 ); // Jz
+        }
     }
     // iDim = 0, local
     int nFieldLocalx = vecPatches.densitiesLocalx.size()/3;
@@ -393,12 +442,16 @@ void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPat
     }
 
     // iDim = 0, finalize (waitall)
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIx[ifield             ], 0 ); // Jx
-        vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIx[ifield+nPatchMPIx  ], 0 ); // Jy
-        vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0 ); // Jz
+    if (vecPatches.aggregatedSumJ_)
+        vecPatches.aggregatedSumJ_->finalizeSumField( fields, vecPatches, 0 );
+    else {
+        #pragma omp for schedule(static)
+        for (unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++) {
+            unsigned int ipatch = vecPatches.MPIxIdx[ifield];
+            vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIx[ifield             ], 0 ); // Jx
+            vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIx[ifield+nPatchMPIx  ], 0 ); // Jy
+            vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0 ); // Jz
+        }
     }
     // END iDim = 0 sync
     // -----------------
@@ -409,12 +462,16 @@ void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPat
 
         // iDim = 1, initialize comms : Isend/Irecv
         unsigned int nPatchMPIy = vecPatches.MPIyIdx.size();
-        #pragma omp for schedule(static)
-        for (unsigned int ifield=0 ; ifield<nPatchMPIy ; ifield++) {
-            unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-            vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIy[ifield             ], 1 ); // Jx
-            vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1 ); // Jy
-            vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1 ); // Jz
+        if (vecPatches.aggregatedSumJ_)
+            vecPatches.aggregatedSumJ_->initSumField( fields, vecPatches, 1 );
+        else {
+            #pragma omp for schedule(static)
+            for (unsigned int ifield=0 ; ifield<nPatchMPIy ; ifield++) {
+                unsigned int ipatch = vecPatches.MPIyIdx[ifield];
+                vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIy[ifield             ], 1 ); // Jx
+                vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1 ); // Jy
+                vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1 ); // Jz
+            }
         }
 
         // iDim = 1,
@@ -454,12 +511,16 @@ void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPat
         }
 
         // iDim = 1, finalize (waitall)
-        #pragma omp for schedule(static)
-        for (unsigned int ifield=0 ; ifield<nPatchMPIy ; ifield=ifield+1) {
-            unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-            vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIy[ifield             ], 1 ); // Jx
-            vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1 ); // Jy
-            vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1 ); // Jz
+        if (vecPatches.aggregatedSumJ_)
+            vecPatches.aggregatedSumJ_->finalizeSumField( fields, vecPatches, 1 );
+        else {
+            #pragma omp for schedule(static)
+            for (unsigned int ifield=0 ; ifield<nPatchMPIy ; ifield=ifield+1) {
+                unsigned int ipatch = vecPatches.MPIyIdx[ifield];
+                vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIy[ifield             ], 1 ); // Jx
+                vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1 ); // Jy
+                vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1 ); // Jz
+            }
         }
         // END iDim = 1 sync
         // -----------------
@@ -470,12 +531,16 @@ void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPat
 
             // iDim = 2, initialize comms : Isend/Irecv
             unsigned int nPatchMPIz = vecPatches.MPIzIdx.size();
-            #pragma omp for schedule(static)
-            for (unsigned int ifield=0 ; ifield<nPatchMPIz ; ifield++) {
-                unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-                vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIz[ifield             ], 2 ); // Jx
-                vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2 ); // Jy
-                vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2 ); // Jz
+            if (vecPatches.aggregatedSumJ_)
+                vecPatches.aggregatedSumJ_->initSumField( fields, vecPatches, 2 );
+            else {
+                #pragma omp for schedule(static)
+                for (unsigned int ifield=0 ; ifield<nPatchMPIz ; ifield++) {
+                    unsigned int ipatch = vecPatches.MPIzIdx[ifield];
+                    vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIz[ifield             ], 2 ); // Jx
+                    vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2 ); // Jy
+                    vecPatches(ipatch)->initSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2 ); // Jz
+                }
             }
 
             // iDim = 2 local
@@ -518,12 +583,16 @@ void SyncVectorPatch::sum_all_components( std::vector<Field*>& fields, VectorPat
             }
 
             // iDim = 2, complete non local sync through MPIfinalize (waitall)
-            #pragma omp for schedule(static)
-            for (unsigned int ifield=0 ; ifield<nPatchMPIz ; ifield=ifield+1) {
-                unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-                vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIz[ifield             ], 2 ); // Jx
-                vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2 ); // Jy
-                vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2 ); // Jz
+            if (vecPatches.aggregatedSumJ_)
+                vecPatches.aggregatedSumJ_->finalizeSumField( fields, vecPatches, 2 );
+            else {
+                #pragma omp for schedule(static)
+                for (unsigned int ifield=0 ; ifield<nPatchMPIz ; ifield=ifield+1) {
+                    unsigned int ipatch = vecPatches.MPIzIdx[ifield];
+                    vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIz[ifield             ], 2 ); // Jx
+                    vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2 ); // Jy
+                    vecPatches(ipatch)->finalizeSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2 ); // Jz
+                }
             }
             // END iDim = 2 sync
             // -----------------
@@ -547,9 +616,18 @@ void SyncVectorPatch::exchangeE( Params& params, VectorPatch& vecPatches )
     // E is exchange if spectral solver and/or at the end of initialisation of non-neutral plasma
 
     if (!params.full_B_exchange) {
-        SyncVectorPatch::exchange_along_all_directions( vecPatches.listEx_, vecPatches );
-        SyncVectorPatch::exchange_along_all_directions( vecPatches.listEy_, vecPatches );
-        SyncVectorPatch::exchange_along_all_directions( vecPatches.listEz_, vecPatches );
+        if (vecPatches.aggregatedE_) {
+            // Ex, Ey and Ez in a single message per neighbor MPI process
+            vecPatches.aggregatedE_->initExchange( vecPatches.Es, vecPatches );
+            SyncVectorPatch::exchange_along_all_directions_local( vecPatches.listEx_, vecPatches );
+            SyncVectorPatch::exchange_along_all_directions_local( vecPatches.listEy_, vecPatches );
+            SyncVectorPatch::exchange_along_all_directions_local( vecPatches.listEz_, vecPatches );
+        }
+        else {
+            SyncVectorPatch::exchange_along_all_directions( vecPatches.listEx_, vecPatches );
+            SyncVectorPatch::exchange_along_all_directions( vecPatches.listEy_, vecPatches );
+            SyncVectorPatch::exchange_along_all_directions( vecPatches.listEz_, vecPatches );
+        }
     }
     else {
         SyncVectorPatch::exchange_synchronized_per_direction( vecPatches.listEx_, vecPatches );
@@ -564,9 +642,13 @@ void SyncVectorPatch::finalizeexchangeE( Params& params, VectorPatch& vecPatches
     // E is exchange if spectral solver and/or at the end of initialisation of non-neutral plasma
 
     if (!params.full_B_exchange) {
-        SyncVectorPatch::finalize_exchange_along_all_directions( vecPatches.listEx_, vecPatches );
-        SyncVectorPatch::finalize_exchange_along_all_directions( vecPatches.listEy_, vecPatches );
-        SyncVectorPatch::finalize_exchange_along_all_directions( vecPatches.listEz_, vecPatches );
+        if (vecPatches.aggregatedE_)
+            vecPatches.aggregatedE_->finalizeExchange( vecPatches.Es, vecPatches );
+        else {
+            SyncVectorPatch::finalize_exchange_along_all_directions( vecPatches.listEx_, vecPatches );
+            SyncVectorPatch::finalize_exchange_along_all_directions( vecPatches.listEy_, vecPatches );
+            SyncVectorPatch::finalize_exchange_along_all_directions( vecPatches.listEz_, vecPatches );
+        }
     }
     //else 
     //    done in exchange_synchronized_per_direction
@@ -653,17 +735,30 @@ void SyncVectorPatch::finalizeexchangeB( Params& params, VectorPatch& vecPatches
 void SyncVectorPatch::exchangeJ( Params& params, VectorPatch& vecPatches )
 {
 
-    SyncVectorPatch::exchange_along_all_directions( vecPatches.listJx_, vecPatches );
-    SyncVectorPatch::exchange_along_all_directions( vecPatches.listJy_, vecPatches );
-    SyncVectorPatch::exchange_along_all_directions( vecPatches.listJz_, vecPatches );
+    if (vecPatches.aggregatedJ_) {
+        // Jx, Jy and Jz in a single message per neighbor MPI process
+        vecPatches.aggregatedJ_->initExchange( vecPatches.densities, vecPatches );
+        SyncVectorPatch::exchange_along_all_directions_local( vecPatches.listJx_, vecPatches );
+        SyncVectorPatch::exchange_along_all_directions_local( vecPatches.listJy_, vecPatches );
+        SyncVectorPatch::exchange_along_all_directions_local( vecPatches.listJz_, vecPatches );
+    }
+    else {
+        SyncVectorPatch::exchange_along_all_directions( vecPatches.listJx_, vecPatches );
+        SyncVectorPatch::exchange_along_all_directions( vecPatches.listJy_, vecPatches );
+        SyncVectorPatch::exchange_along_all_directions( vecPatches.listJz_, vecPatches );
+    }
 }
 
 void SyncVectorPatch::finalizeexchangeJ( Params& params, VectorPatch& vecPatches )
 {
 
-    SyncVectorPatch::finalize_exchange_along_all_directions( vecPatches.listJx_, vecPatches );
-    SyncVectorPatch::finalize_exchange_along_all_directions( vecPatches.listJy_, vecPatches );
-    SyncVectorPatch::finalize_exchange_along_all_directions( vecPatches.listJz_, vecPatches );
+    if (vecPatches.aggregatedJ_)
+        vecPatches.aggregatedJ_->finalizeExchange( vecPatches.densities, vecPatches );
+    else {
+        SyncVectorPatch::finalize_exchange_along_all_directions( vecPatches.listJx_, vecPatches );
+        SyncVectorPatch::finalize_exchange_along_all_directions( vecPatches.listJy_, vecPatches );
+        SyncVectorPatch::finalize_exchange_along_all_directions( vecPatches.listJz_, vecPatches );
+    }
 }
 
 
@@ -677,7 +772,13 @@ void SyncVectorPatch::exchange_along_all_directions( std::vector<Field*> fields,
             vecPatches(ipatch)->initExchange( fields[ipatch], iDim );
     } // End for iDim
 
+    SyncVectorPatch::exchange_along_all_directions_local( fields, vecPatches );
+
+}
 
+// Intra-MPI process exchanges of exchange_along_all_directions, managed by memcpy
+void SyncVectorPatch::exchange_along_all_directions_local( std::vector<Field*>& fields, VectorPatch& vecPatches )
+{
     unsigned int nx_, ny_(1), nz_(1), h0, oversize[3], n_space[3], gsp[3];
     double *pt1,*pt2;
     h0 = vecPatches(0)->hindex;
@@ -967,11 +1068,15 @@ void SyncVectorPatch::exchange_synchronized_per_direction( std::vector<Field*> f
 void SyncVectorPatch::exchange_all_components_along_X( std::vector<Field*>& fields, VectorPatch& vecPatches )
 {
     unsigned int nMPIx = vecPatches.MPIxIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nMPIx ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches(ipatch)->initExchange( vecPatches.B_MPIx[ifield      ], 0 ); // By
-        vecPatches(ipatch)->initExchange( vecPatches.B_MPIx[ifield+nMPIx], 0 ); // Bz
+    if (vecPatches.aggregatedB_)
+        vecPatches.aggregatedB_->initExchange( fields, vecPatches, 0 );
+    else {
+        #pragma omp for schedule(static)
+        for (unsigned int ifield=0 ; ifield<nMPIx ; ifield++) {
+            unsigned int ipatch = vecPatches.MPIxIdx[ifield];
+            vecPatches(ipatch)->initExchange( vecPatches.B_MPIx[ifield      ], 0 ); // By
+            vecPatches(ipatch)->initExchange( vecPatches.B_MPIx[ifield+nMPIx], 0 ); // Bz
+        }
     }
 
 
@@ -1021,11 +1126,15 @@ void SyncVectorPatch::exchange_all_components_along_X( std::vector<Field*>& fiel
 void SyncVectorPatch::finalize_exchange_all_components_along_X( std::vector<Field*>& fields, VectorPatch& vecPatches )
 {
     unsigned int nMPIx = vecPatches.MPIxIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nMPIx ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches(ipatch)->finalizeExchange( vecPatches.B_MPIx[ifield      ], 0 ); // By
-        vecPatches(ipatch)->finalizeExchange( vecPatches.B_MPIx[ifield+nMPIx], 0 ); // Bz
+    if (vecPatches.aggregatedB_)
+        vecPatches.aggregatedB_->finalizeExchange( fields, vecPatches, 0 );
+    else {
+        #pragma omp for schedule(static)
+        for (unsigned int ifield=0 ; ifield<nMPIx ; ifield++) {
+            unsigned int ipatch = vecPatches.MPIxIdx[ifield];
+            vecPatches(ipatch)->finalizeExchange( vecPatches.B_MPIx[ifield      ], 0 ); // By
+            vecPatches(ipatch)->finalizeExchange( vecPatches.B_MPIx[ifield+nMPIx], 0 ); // Bz
+        }
     }
 }
 
@@ -1040,11 +1149,15 @@ void SyncVectorPatch::finalize_exchange_all_components_along_X( std::vector<Fiel
 void SyncVectorPatch::exchange_all_components_along_Y( std::vector<Field*>& fields, VectorPatch& vecPatches )
 {
     unsigned int nMPIy = vecPatches.MPIyIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nMPIy ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-        vecPatches(ipatch)->initExchange( vecPatches.B1_MPIy[ifield], 1 );   // Bx
-        vecPatches(ipatch)->initExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1 ); // Bz
+    if (vecPatches.aggregatedB_)
+        vecPatches.aggregatedB_->initExchange( fields, vecPatches, 1 );
+    else {
+        #pragma omp for schedule(static)
+        for (unsigned int ifield=0 ; ifield<nMPIy ; ifield++) {
+            unsigned int ipatch = vecPatches.MPIyIdx[ifield];
+            vecPatches(ipatch)->initExchange( vecPatches.B1_MPIy[ifield], 1 );   // Bx
+            vecPatches(ipatch)->initExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1 ); // Bz
+        }
     }
 
     unsigned int h0, oversize, n_space;
@@ -1096,11 +1209,15 @@ void SyncVectorPatch::exchange_all_components_along_Y( std::vector<Field*>& fiel
 void SyncVectorPatch::finalize_exchange_all_components_along_Y( std::vector<Field*>& fields, VectorPatch& vecPatches )
 {
     unsigned int nMPIy = vecPatches.MPIyIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nMPIy ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-        vecPatches(ipatch)->finalizeExchange( vecPatches.B1_MPIy[ifield      ], 1 ); // By
-        vecPatches(ipatch)->finalizeExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1 ); // Bz
+    if (vecPatches.aggregatedB_)
+        vecPatches.aggregatedB_->finalizeExchange( fields, vecPatches, 1 );
+    else {
+        #pragma omp for schedule(static)
+        for (unsigned int ifield=0 ; ifield<nMPIy ; ifield++) {
+            unsigned int ipatch = vecPatches.MPIyIdx[ifield];
+            vecPatches(ipatch)->finalizeExchange( vecPatches.B1_MPIy[ifield      ], 1 ); // By
+            vecPatches(ipatch)->finalizeExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1 ); // Bz
+        }
     }
 
 
@@ -1117,11 +1234,15 @@ void SyncVectorPatch::finalize_exchange_all_components_along_Y( std::vector<Fiel
 void SyncVectorPatch::exchange_all_components_along_Z( std::vector<Field*> fields, VectorPatch& vecPatches )
 {
     unsigned int nMPIz = vecPatches.MPIzIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nMPIz ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-        vecPatches(ipatch)->initExchange( vecPatches.B2_MPIz[ifield],       2 ); // Bx
-        vecPatches(ipatch)->initExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2 ); // By
+    if (vecPatches.aggregatedB_)
+        vecPatches.aggregatedB_->initExchange( fields, vecPatches, 2 );
+    else {
+        #pragma omp for schedule(static)
+        for (unsigned int ifield=0 ; ifield<nMPIz ; ifield++) {
+            unsigned int ipatch = vecPatches.MPIzIdx[ifield];
+            vecPatches(ipatch)->initExchange( vecPatches.B2_MPIz[ifield],       2 ); // Bx
+            vecPatches(ipatch)->initExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2 ); // By
+        }
     }
 
     unsigned int h0, oversize, n_space;
@@ -1171,11 +1292,15 @@ void SyncVectorPatch::exchange_all_components_along_Z( std::vector<Field*> field
 void SyncVectorPatch::finalize_exchange_all_components_along_Z( std::vector<Field*> fields, VectorPatch& vecPatches )
 {
     unsigned int nMPIz = vecPatches.MPIzIdx.size();
-    #pragma omp for schedule(static)
-    for (unsigned int ifield=0 ; ifield<nMPIz ; ifield++) {
-        unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-        vecPatches(ipatch)->finalizeExchange( vecPatches.B2_MPIz[ifield      ], 2 ); // Bx
-        vecPatches(ipatch)->finalizeExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2 ); // By
+    if (vecPatches.aggregatedB_)
+        vecPatches.aggregatedB_->finalizeExchange( fields, vecPatches, 2 );
+    else {
+        #pragma omp for schedule(static)
+        for (unsigned int ifield=0 ; ifield<nMPIz ; ifield++) {
+            unsigned int ipatch = vecPatches.MPIzIdx[ifield];
+            vecPatches(ipatch)->finalizeExchange( vecPatches.B2_MPIz[ifield      ], 2 ); // Bx
+            vecPatches(ipatch)->finalizeExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2 ); // By
+        }
     }
 
 }
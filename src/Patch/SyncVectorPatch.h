@@ -33,6 +33,7 @@ public :
 
     static void exchange_along_all_directions         ( std::vector<Field*> fields, VectorPatch& vecPatches );
     static void finalize_exchange_along_all_directions( std::vector<Field*> fields, VectorPatch& vecPatches );
+    static void exchange_along_all_directions_local   ( std::vector<Field*>& fields, VectorPatch& vecPatches );
     static void exchange_along_all_directions_noomp         ( std::vector<Field*> fields, VectorPatch& vecPatches );
     static void finalize_exchange_along_all_directions_noomp( std::vector<Field*> fields, VectorPatch& vecPatches );
     static void exchange_synchronized_per_direction   ( std::vector<Field*> fields, VectorPatch& vecPatches );
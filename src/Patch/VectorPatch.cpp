@@ -28,12 +28,22 @@ using namespace std;
 VectorPatch::VectorPatch()
 {
     domain_decomposition_ = NULL ;
+    aggregatedE_    = NULL;
+    aggregatedB_    = NULL;
+    aggregatedJ_    = NULL;
+    aggregatedSumJ_ = NULL;
+    aggregatedSum_  = NULL;
 }
 
 
 VectorPatch::VectorPatch( Params& params )
 {
     domain_decomposition_ = DomainDecompositionFactory::create( params );
+    aggregatedE_    = NULL;
+    aggregatedB_    = NULL;
+    aggregatedJ_    = NULL;
+    aggregatedSumJ_ = NULL;
+    aggregatedSum_  = NULL;
 }
 
 
@@ -74,6 +84,44 @@ void VectorPatch::close(SmileiMPI * smpiData)
         delete patches_[ipatch];
 
     patches_.clear();
+
+    // The persistent requests must be freed before MPI_Finalize
+    delete aggregatedE_;
+    delete aggregatedB_;
+    delete aggregatedJ_;
+    delete aggregatedSumJ_;
+    delete aggregatedSum_;
+    aggregatedE_    = NULL;
+    aggregatedB_    = NULL;
+    aggregatedJ_    = NULL;
+    aggregatedSumJ_ = NULL;
+    aggregatedSum_  = NULL;
+    for (unsigned int ispec=0 ; ispec<aggregatedSpecies_.size() ; ispec++)
+        delete aggregatedSpecies_[ispec];
+    aggregatedSpecies_.clear();
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create the field synchronizations with one MPI message per neighbor process
+// Their messages are built at their first use, and rebuilt if the patch distribution changes
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::createAggregatedMPIbuffers( SmileiMPI* smpi )
+{
+    aggregatedE_    = new AggregatedMPIbuffers( smpi->getFieldsComm(), 0 );
+    aggregatedB_    = new AggregatedMPIbuffers( smpi->getFieldsComm(), 1 );
+    aggregatedJ_    = new AggregatedMPIbuffers( smpi->getFieldsComm(), 2 );
+    aggregatedSumJ_ = new AggregatedMPIbuffers( smpi->getFieldsComm(), 3 );
+    aggregatedSum_  = new AggregatedMPIbuffers( smpi->getFieldsComm(), 4 );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create the particle exchanges with one MPI message per neighbor process, one per species
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::createAggregatedSpeciesMPIbuffers( SmileiMPI* smpi )
+{
+    for (unsigned int ispec=0 ; ispec<(*this)(0)->vecSpecies.size() ; ispec++)
+        aggregatedSpecies_.push_back( new AggregatedSpeciesMPIbuffers( smpi->getParticlesComm(), ispec ) );
 }
 
 void VectorPatch::createDiags(Params& params, SmileiMPI* smpi, OpenPMDparams& openPMD)
@@ -148,8 +196,11 @@ void VectorPatch::dynamics(Params& params,
     #pragma omp for schedule(runtime)
     for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
         (*this)(ipatch)->EMfields->restartRhoJ();
+        (*this)(ipatch)->measured_steps++;
         for (unsigned int ispec=0 ; ispec<(*this)(ipatch)->vecSpecies.size() ; ispec++) {
             if ( (*this)(ipatch)->vecSpecies[ispec]->isProj(time_dual, simWindow) || diag_flag  ) {
+                // Random stream of this patch, species and timestep
+                species(ipatch, ispec)->random.init( params.random_seed, (*this)(ipatch)->hindex, Random::stream_dynamics + ispec, itime );
                 species(ipatch, ispec)->dynamics(time_dual, ispec,
                                                  emfields(ipatch), interp(ipatch), proj(ipatch),
                                                  params, diag_flag, partwalls(ipatch),
@@ -1447,6 +1498,7 @@ void VectorPatch::update_field_list()
 {
     int nDim = patches_[0]->EMfields->Ex_->dims_.size();
     densities.resize( 3*size() ) ; // Jx + Jy + Jz
+    Es.resize( 3*size() ) ;        // Ex + Ey + Ez
 
     //                          1D  2D  3D
     Bs0.resize( 2*size() ) ; //  2   2   2
@@ -1504,6 +1556,10 @@ void VectorPatch::update_field_list()
         densities[ipatch+  size()] = patches_[ipatch]->EMfields->Jy_ ;
         densities[ipatch+2*size()] = patches_[ipatch]->EMfields->Jz_ ;
 
+        Es[ipatch         ] = patches_[ipatch]->EMfields->Ex_ ;
+        Es[ipatch+  size()] = patches_[ipatch]->EMfields->Ey_ ;
+        Es[ipatch+2*size()] = patches_[ipatch]->EMfields->Ez_ ;
+
         Bs0[ipatch       ] = patches_[ipatch]->EMfields->By_ ;
         Bs0[ipatch+size()] = patches_[ipatch]->EMfields->Bz_ ;
 
@@ -19,6 +19,7 @@
 #include "SimWindow.h"
 #include "Timers.h"
 #include "RadiationTables.h"
+#include "AggregatedMPIbuffers.h"
 
 class Field;
 class Timer;
@@ -174,6 +175,7 @@ public :
 
     // Lists of fields
     std::vector<Field*> densities;
+    std::vector<Field*> Es;
 
     std::vector<Field*> Bs0;
     std::vector<Field*> Bs1;
@@ -216,6 +218,21 @@ public :
     std::vector<Field*> listBy_;
     std::vector<Field*> listBz_;
 
+    //! Field synchronizations with one MPI message per neighbor process (NULL if aggregate_field_exchange is False)
+    //!   One per synchronization which can be in progress at the same time as another one
+    AggregatedMPIbuffers* aggregatedE_;
+    AggregatedMPIbuffers* aggregatedB_;
+    AggregatedMPIbuffers* aggregatedJ_;
+    AggregatedMPIbuffers* aggregatedSumJ_;
+    AggregatedMPIbuffers* aggregatedSum_;
+    //! Create the aggregated field synchronizations
+    void createAggregatedMPIbuffers( SmileiMPI* smpi );
+
+    //! Particle exchanges with one MPI message per neighbor process, per species (empty if aggregate_particle_exchange is False)
+    std::vector<AggregatedSpeciesMPIbuffers*> aggregatedSpecies_;
+    //! Create the aggregated particle exchanges
+    void createAggregatedSpeciesMPIbuffers( SmileiMPI* smpi );
+
     //! True if any antennas
     unsigned int nAntennas;
 
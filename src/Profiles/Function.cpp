@@ -1,5 +1,6 @@
 #include "Function.h"
 #include <cmath>
+#include <mpi.h>
 
 using namespace std;
 
@@ -285,3 +286,123 @@ double Function_TimeSin2Plateau::valueAt(double time) {
     return 0.;
   }
 }
+
+// Tabulated time profile
+Function_TimeTabulated::Function_TimeTabulated( Function_Python1D *f, double tmin, double tmax, double dt, double tolerance ) :
+    python_function( f ),
+    tmin( tmin ),
+    accurate( true ),
+    table( make_shared<Table>() )
+{
+    int rank;
+    MPI_Comm_rank( MPI_COMM_WORLD, &rank );
+    if( rank == 0 )
+        sample( tmax, dt, tolerance );
+    
+    // Broadcast the table built by the master
+    int sizes[3] = { (int)table->coarse.size(), (int)table->fine.size(), (int)accurate };
+    MPI_Bcast( sizes, 3, MPI_INT, 0, MPI_COMM_WORLD );
+    table->coarse.resize( sizes[0] );
+    table->fine  .resize( sizes[1] );
+    table->offset.resize( sizes[0]-1 );
+    table->level .resize( sizes[0]-1 );
+    accurate = sizes[2];
+    MPI_Bcast( table->coarse.data(), sizes[0]  , MPI_DOUBLE, 0, MPI_COMM_WORLD );
+    MPI_Bcast( table->fine  .data(), sizes[1]  , MPI_DOUBLE, 0, MPI_COMM_WORLD );
+    MPI_Bcast( table->offset.data(), sizes[0]-1, MPI_INT   , 0, MPI_COMM_WORLD );
+    MPI_Bcast( table->level .data(), sizes[0]-1, MPI_INT   , 0, MPI_COMM_WORLD );
+    
+    inv_dt = (sizes[0]-1)/(tmax-tmin);
+}
+void Function_TimeTabulated::sample( double tmax, double dt, double tolerance ) {
+    unsigned int n = (unsigned int) ceil( (tmax-tmin)/dt );
+    if( n < 3 ) n = 3;
+    double h = (tmax-tmin)/n;
+    
+    vector<double> &coarse = table->coarse;
+    coarse.resize( n+1 );
+    double norm = 0.;
+    for( unsigned int i=0; i<=n; i++ ) {
+        coarse[i] = python_function.valueAt( tmin + i*h );
+        norm = max( norm, abs( coarse[i] ) );
+    }
+    table->offset.assign( n, -1 );
+    table->level .assign( n,  0 );
+    
+    // Check each cell at its mid-point. Cells that are not accurate enough are refined locally,
+    // the mid-points used for the check becoming the new points, until the tolerance is reached
+    // or until the cell is 2^max_level times smaller (discontinuous profiles never converge).
+    vector<double> block, mid, refined;
+    for( unsigned int c=0; c<n; c++ ) {
+        double t0 = tmin + c*h;
+        mid.assign( 1, python_function.valueAt( t0 + 0.5*h ) );
+        if( abs( mid[0] - interpolate( coarse, c+0.5 ) ) <= tolerance * norm ) continue;
+        
+        // Level 0 block, with the points around the cell
+        block.resize( 4 );
+        block[0] = python_function.valueAt( t0 - h );
+        block[1] = coarse[c];
+        block[2] = coarse[c+1];
+        block[3] = python_function.valueAt( t0 + 2.*h );
+        int l = 0;
+        double error;
+        do {
+            // Refine the block, using the mid-points
+            int m = 1<<l;
+            double hl = h/(2*m);
+            refined.resize( 2*m+3 );
+            refined[0] = python_function.valueAt( t0 - hl );
+            for( int k=0; k<m; k++ ) {
+                refined[2*k+1] = block[k+1];
+                refined[2*k+2] = mid[k];
+            }
+            refined[2*m+1] = block[m+1];
+            refined[2*m+2] = python_function.valueAt( t0 + h + hl );
+            block.swap( refined );
+            l++;
+            // Check at the new mid-points
+            m *= 2;
+            mid.resize( m );
+            error = 0.;
+            for( int k=0; k<m; k++ ) {
+                mid[k] = python_function.valueAt( t0 + (k+0.5)*hl );
+                error = max( error, abs( mid[k] - cubic( block[k], block[k+1], block[k+2], block[k+3], 0.5 ) ) );
+            }
+        } while( error > tolerance * norm && l < max_level );
+        if( error > tolerance * norm ) accurate = false;
+        
+        table->offset[c] = table->fine.size();
+        table->level [c] = l;
+        table->fine.insert( table->fine.end(), block.begin(), block.end() );
+    }
+}
+double Function_TimeTabulated::interpolate( vector<double> &values, double x ) {
+    int n = values.size();
+    int i = (int) x;
+    if( i > n-2 ) i = n-2;
+    double u = x - i;
+    return cubic( values[ i>0 ? i-1 : 0 ], values[i], values[i+1], values[ i<n-2 ? i+2 : n-1 ], u );
+}
+double Function_TimeTabulated::valueAt(double time) {
+    double x = (time-tmin)*inv_dt;
+    int ncells = table->offset.size();
+    if( x >= 0. && x <= ncells ) {
+        int c = min( (int) x, ncells-1 );
+        if( table->offset[c] < 0 )
+            return interpolate( table->coarse, x );
+        // Refined cell
+        int m = 1<<table->level[c];
+        double xl = (x-c)*m;
+        int i = min( (int) xl, m-1 );
+        double *block = &table->fine[table->offset[c]+i];
+        return cubic( block[0], block[1], block[2], block[3], xl-i );
+    }
+    // Out of the table: call python
+    double value;
+    #pragma omp critical
+    value = python_function.valueAt( time );
+    return value;
+}
+double Function_TimeTabulated::valueAt(vector<double> x_cell, double time) {
+    return valueAt( time );
+}
@@ -4,6 +4,7 @@
 #include "PyTools.h"
 #include <vector>
 #include <string>
+#include <memory>
 
 class Function
 {
@@ -838,4 +839,51 @@ class Function_TimeSin2Plateau : public Function{
     double start, slope1, plateau, slope2, end;
 };
 
+
+// Python time profile sampled once, then interpolated with cubic (Catmull-Rom) splines.
+// The profile is sampled at every timestep, and only the cells of this coarse grid where the
+// interpolation error at mid-points is above the tolerance are refined, each on its own finer grid.
+// The sampling is done by the master process and broadcast. Outside the table, the python function is called.
+class Function_TimeTabulated : public Function
+{
+public:
+    Function_TimeTabulated ( Function_Python1D *f, double tmin, double tmax, double dt, double tolerance );
+    Function_TimeTabulated ( Function_TimeTabulated *f ) :
+        python_function( &(f->python_function) ),
+        tmin( f->tmin ),
+        inv_dt( f->inv_dt ),
+        accurate( f->accurate ),
+        table( f->table ) {};
+    double valueAt(double);
+    double valueAt(std::vector<double>, double); // time (space discarded)
+    //! Number of points in the table
+    inline unsigned int size() { return table->coarse.size() + table->fine.size(); };
+    //! False if the tolerance could not be reached (discontinuous profile)
+    inline bool isAccurate() { return accurate; };
+    //! Maximum number of refinements of a cell of the coarse grid
+    static const int max_level = 5;
+private:
+    //! Catmull-Rom interpolation between p1 and p2, at the fraction u of the interval
+    static inline double cubic( double p0, double p1, double p2, double p3, double u ) {
+        return p1 + 0.5*u*( p2-p0 + u*( 2.*p0-5.*p1+4.*p2-p3 + u*( 3.*(p1-p2)+p3-p0 ) ) );
+    };
+    //! Cubic interpolation in the coarse grid, x being the (fractional) index
+    static double interpolate( std::vector<double> &values, double x );
+    //! Sample the cells of the coarse grid, refining those where the tolerance is not reached
+    void sample( double tmax, double dt, double tolerance );
+    Function_Python1D python_function;
+    double tmin, inv_dt;
+    bool accurate;
+    //! Sampled values, shared between the clones of the profile
+    struct Table {
+        //! Values at each timestep
+        std::vector<double> coarse;
+        //! Values in the refined cells: for a cell at level l, the 2^l+1 points of the cell and one more on each side
+        std::vector<double> fine;
+        //! For each cell of the coarse grid, position of its values in `fine` (-1 if not refined) and level
+        std::vector<int> offset, level;
+    };
+    std::shared_ptr<Table> table;
+};
+
 #endif
@@ -300,6 +300,8 @@ Profile::Profile(Profile *p){
       function = new Function_TimePolynomial(static_cast<Function_TimePolynomial*>(p->function));
     } else if( profileName == "tsin2plateau" ){
       function = new Function_TimeSin2Plateau(static_cast<Function_TimeSin2Plateau*>(p->function));
+    } else if( profileName == "tabulated" ){
+      function = new Function_TimeTabulated(static_cast<Function_TimeTabulated*>(p->function));
     }
   }else {
     if      ( nvariables == 1 ) function = new Function_Python1D(static_cast<Function_Python1D*>(p->function));
@@ -316,4 +318,22 @@ Profile::~Profile()
 }
 
 
+// Tabulate a python time profile, so that it can be evaluated without calling python
+bool Profile::tabulate( double tmin, double tmax, double dt, double tolerance )
+{
+    if( profileName != "" || nvariables != 1 ) return true;
+    
+    Function_TimeTabulated * f = new Function_TimeTabulated( static_cast<Function_Python1D*>(function), tmin, tmax, dt, tolerance );
+    delete function;
+    function = f;
+    profileName = "tabulated";
+    
+    ostringstream info_("");
+    info_ << info << " (tabulated on " << f->size() << " points)";
+    info = info_.str();
+    
+    return f->isAccurate();
+}
+
+
 
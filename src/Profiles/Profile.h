@@ -66,6 +66,10 @@ public:
         }
     };
     
+    //! Replace a python time profile by a table of its values, sampled in [tmin, tmax].
+    //! Returns false if the requested tolerance could not be reached.
+    bool tabulate( double tmin, double tmax, double dt, double tolerance );
+    
     //! Get info on the loaded profile, to be printed later
     inline std::string getInfo() { return info; };
     
@@ -307,7 +307,7 @@ void Projector1D4Order::operator() (ElectroMagn* EMfields, Particles &particles,
             double* b_Jy =  &(*EMfields->Jy_ )(ibin*clrw);
             double* b_Jz =  &(*EMfields->Jz_ )(ibin*clrw);
             for (int ipart=istart ; ipart<iend; ipart++ )
-                (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+                (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*invgf)[ipart-istart], ibin*clrw, b_dim, &(*iold)[ipart-istart], &(*delta)[ipart-istart]);
                  }
         else {
             double* b_Jx =  &(*EMfields->Jx_ )(ibin*clrw);
@@ -315,7 +315,7 @@ void Projector1D4Order::operator() (ElectroMagn* EMfields, Particles &particles,
             double* b_Jz =  &(*EMfields->Jz_ )(ibin*clrw);
             double* b_rho=  &(*EMfields->rho_)(ibin*clrw);
             for ( int ipart=istart ; ipart<iend; ipart++ )
-                (*this)(b_Jx , b_Jy , b_Jz , b_rho , particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+                (*this)(b_Jx , b_Jy , b_Jz , b_rho , particles,  ipart, (*invgf)[ipart-istart], ibin*clrw, b_dim, &(*iold)[ipart-istart], &(*delta)[ipart-istart]);
         }   
     // Otherwise, the projection may apply to the species-specific arrays
     } else {
@@ -324,7 +324,7 @@ void Projector1D4Order::operator() (ElectroMagn* EMfields, Particles &particles,
         double* b_Jz  = EMfields->Jz_s [ispec] ? &(*EMfields->Jz_s [ispec])(ibin*clrw) : &(*EMfields->Jz_ )(ibin*clrw) ;
         double* b_rho = EMfields->rho_s[ispec] ? &(*EMfields->rho_s[ispec])(ibin*clrw) : &(*EMfields->rho_)(ibin*clrw) ;
         for (int ipart=istart ; ipart<iend; ipart++ )
-            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*invgf)[ipart-istart], ibin*clrw, b_dim, &(*iold)[ipart-istart], &(*delta)[ipart-istart]);
     }
 
 }
@@ -0,0 +1,233 @@
+#include "Projector2D2OrderV.h"
+
+#include <cmath>
+#include <iostream>
+
+#include "ElectroMagn.h"
+#include "Field2D.h"
+#include "Particles.h"
+#include "Tools.h"
+#include "Patch.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor for Projector2D2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Projector2D2OrderV::Projector2D2OrderV (Params& params, Patch* patch) : Projector2D2Order(params, patch)
+{
+    one_third = 1.0/3.0;
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor for Projector2D2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Projector2D2OrderV::~Projector2D2OrderV()
+{
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project current densities of a pack of particles
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector2D2OrderV::currents(double* Jx, double* Jy, double* Jz, Particles &particles, int istart, int npack, double* invgf, int* iold, double* deltaold, int nparts, int bin, std::vector<unsigned int> &b_dim)
+{
+    const int N = vecto_size;
+
+    // Esirkepov coefficients of the pack, stored as [stencil point][particle]
+    double Sx0[5*N], Sy0[5*N], DSx[5*N], DSy[5*N];
+    double crx[N], cry[N], crz[N];
+    int ipo[N], jpo[N];
+
+    double* position_x = &( particles.position(0, istart) );
+    double* position_y = &( particles.position(1, istart) );
+    double* momentum_z = &( particles.momentum(2, istart) );
+    double* weight     = &( particles.weight(istart) );
+    short*  charge     = &( particles.charge(istart) );
+
+    // --------------------------------------------------------
+    // Locate particles & Calculate Esirkepov coef. S, DS
+    // --------------------------------------------------------
+    #pragma omp simd
+    for (int ipart=0 ; ipart<npack ; ipart++) {
+        double charge_weight = (double)(charge[ipart])*weight[ipart];
+        crx[ipart] = charge_weight*dx_ov_dt;
+        cry[ipart] = charge_weight*dy_ov_dt;
+        crz[ipart] = charge_weight*momentum_z[ipart]*invgf[ipart];
+
+        // locate the particle on the primal grid at former time-step & calculate coeff. S0
+        double delta  = deltaold[ipart];
+        double delta2 = delta*delta;
+        Sx0[    ipart] = 0.;
+        Sx0[  N+ipart] = 0.5 * (delta2-delta+0.25);
+        Sx0[2*N+ipart] = 0.75-delta2;
+        Sx0[3*N+ipart] = 0.5 * (delta2+delta+0.25);
+        Sx0[4*N+ipart] = 0.;
+
+        delta  = deltaold[nparts+ipart];
+        delta2 = delta*delta;
+        Sy0[    ipart] = 0.;
+        Sy0[  N+ipart] = 0.5 * (delta2-delta+0.25);
+        Sy0[2*N+ipart] = 0.75-delta2;
+        Sy0[3*N+ipart] = 0.5 * (delta2+delta+0.25);
+        Sy0[4*N+ipart] = 0.;
+
+        // locate the particle on the primal grid at current time-step & calculate coeff. S1
+        // the 3-point stencil is shifted by ip_m_ipo (-1, 0 or 1) in the 5-point array
+        double xpn = position_x[ipart] * dx_inv_;
+        int ip = round(xpn);
+        ipo[ipart] = iold[ipart];
+        int ip_m_ipo = ip-ipo[ipart]-i_domain_begin;
+        delta  = xpn - (double)ip;
+        delta2 = delta*delta;
+        double Sm = 0.5 * (delta2-delta+0.25);
+        double S  = 0.75-delta2;
+        double Sp = 0.5 * (delta2+delta+0.25);
+        for (int i=0 ; i<5 ; i++) {
+            int k = i-2-ip_m_ipo;
+            double Sx1 = k==-1 ? Sm : ( k==0 ? S : ( k==1 ? Sp : 0. ) );
+            DSx[i*N+ipart] = Sx1 - Sx0[i*N+ipart];
+        }
+
+        double ypn = position_y[ipart] * dy_inv_;
+        int jp = round(ypn);
+        jpo[ipart] = iold[nparts+ipart];
+        int jp_m_jpo = jp-jpo[ipart]-j_domain_begin;
+        delta  = ypn - (double)jp;
+        delta2 = delta*delta;
+        Sm = 0.5 * (delta2-delta+0.25);
+        S  = 0.75-delta2;
+        Sp = 0.5 * (delta2+delta+0.25);
+        for (int j=0 ; j<5 ; j++) {
+            int k = j-2-jp_m_jpo;
+            double Sy1 = k==-1 ? Sm : ( k==0 ? S : ( k==1 ? Sp : 0. ) );
+            DSy[j*N+ipart] = Sy1 - Sy0[j*N+ipart];
+        }
+    }
+
+    // ------------------------------------------------
+    // Local current created by each particle
+    // calculate using the charge conservation equation
+    // ------------------------------------------------
+    double bJx[25*N], bJy[25*N], bJz[25*N];
+
+    // Jx^(d,p) : Jx_p[i][j] = Jx_p[i-1][j] - crx_p * Wx[i-1][j]
+    for (int j=0 ; j<5 ; j++) {
+        #pragma omp simd
+        for (int ipart=0 ; ipart<npack ; ipart++)
+            bJx[j*N+ipart] = 0.;
+    }
+    for (int i=1 ; i<5 ; i++) {
+        for (int j=0 ; j<5 ; j++) {
+            #pragma omp simd
+            for (int ipart=0 ; ipart<npack ; ipart++)
+                bJx[(i*5+j)*N+ipart] = bJx[((i-1)*5+j)*N+ipart]
+                    - crx[ipart] * DSx[(i-1)*N+ipart] * ( Sy0[j*N+ipart] + 0.5*DSy[j*N+ipart] );
+        }
+    }
+
+    // Jy^(p,d) : Jy_p[i][j] = Jy_p[i][j-1] - cry_p * Wy[i][j-1]
+    for (int i=0 ; i<5 ; i++) {
+        #pragma omp simd
+        for (int ipart=0 ; ipart<npack ; ipart++)
+            bJy[(i*5)*N+ipart] = 0.;
+        for (int j=1 ; j<5 ; j++) {
+            #pragma omp simd
+            for (int ipart=0 ; ipart<npack ; ipart++)
+                bJy[(i*5+j)*N+ipart] = bJy[(i*5+j-1)*N+ipart]
+                    - cry[ipart] * DSy[(j-1)*N+ipart] * ( Sx0[i*N+ipart] + 0.5*DSx[i*N+ipart] );
+        }
+    }
+
+    // Jz^(p,p) : Jz_p[i][j] = crz_p * Wz[i][j]
+    for (int i=0 ; i<5 ; i++) {
+        for (int j=0 ; j<5 ; j++) {
+            #pragma omp simd
+            for (int ipart=0 ; ipart<npack ; ipart++)
+                bJz[(i*5+j)*N+ipart] = crz[ipart] * (  Sx0[i*N+ipart]*Sy0[j*N+ipart]
+                                                     + 0.5*DSx[i*N+ipart]*Sy0[j*N+ipart]
+                                                     + 0.5*Sx0[i*N+ipart]*DSy[j*N+ipart]
+                                                     + one_third*DSx[i*N+ipart]*DSy[j*N+ipart] );
+        }
+    }
+
+    // ---------------------------
+    // Calculate the total current
+    // ---------------------------
+    int imin = ipo[0], imax = ipo[0], jmin = jpo[0], jmax = jpo[0];
+    for (int ipart=1 ; ipart<npack ; ipart++) {
+        imin = min( imin, ipo[ipart] );
+        imax = max( imax, ipo[ipart] );
+        jmin = min( jmin, jpo[ipart] );
+        jmax = max( jmax, jpo[ipart] );
+    }
+
+    if ( imax-imin <= tile_size-5 && jmax-jmin <= tile_size-5 ) {
+        // Reduce the particles of the pack in a local tile, then add the tile to the grid
+        double tJx[tile_size*tile_size], tJy[tile_size*tile_size], tJz[tile_size*tile_size];
+        for (int i=0 ; i<tile_size*tile_size ; i++) {
+            tJx[i] = 0.;
+            tJy[i] = 0.;
+            tJz[i] = 0.;
+        }
+        for (int ipart=0 ; ipart<npack ; ipart++) {
+            int iloc = (ipo[ipart]-imin)*tile_size + jpo[ipart]-jmin;
+            for (int i=0 ; i<5 ; i++) {
+                for (int j=0 ; j<5 ; j++) {
+                    tJx[iloc+i*tile_size+j] += bJx[(i*5+j)*N+ipart];
+                    tJy[iloc+i*tile_size+j] += bJy[(i*5+j)*N+ipart];
+                    tJz[iloc+i*tile_size+j] += bJz[(i*5+j)*N+ipart];
+                }
+            }
+        }
+        //This minus 2 come from the order 2 scheme, based on a 5 points stencil from -2 to +2.
+        add_tile( Jx, b_dim[1]  , tJx, 5+imax-imin, 5+jmax-jmin, imin-bin-2, jmin-2 );
+        add_tile( Jy, b_dim[1]+1, tJy, 5+imax-imin, 5+jmax-jmin, imin-bin-2, jmin-2 ); //Because size of Jy in Y is b_dim[1]+1.
+        add_tile( Jz, b_dim[1]  , tJz, 5+imax-imin, 5+jmax-jmin, imin-bin-2, jmin-2 );
+    }
+    else {
+        // Particles of the pack are too far apart: each of them is added to the grid
+        for (int ipart=0 ; ipart<npack ; ipart++) {
+            int io = ipo[ipart]-bin-2;
+            int jo = jpo[ipart]-2;
+            for (int i=0 ; i<5 ; i++) {
+                for (int j=0 ; j<5 ; j++) {
+                    Jx[(io+i)* b_dim[1]    + jo+j] += bJx[(i*5+j)*N+ipart];
+                    Jy[(io+i)*(b_dim[1]+1) + jo+j] += bJy[(i*5+j)*N+ipart];
+                    Jz[(io+i)* b_dim[1]    + jo+j] += bJz[(i*5+j)*N+ipart];
+                }
+            }
+        }
+    }
+} // END Project local current densities of a pack
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Wrapper for projection
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector2D2OrderV::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, bool diag_flag, bool is_spectral, std::vector<unsigned int> &b_dim, int ispec)
+{
+    // Charge densities are only projected by the scalar projector
+    if (diag_flag || is_spectral) {
+        Projector2D2Order::operator()(EMfields, particles, smpi, istart, iend, ithread, ibin, clrw, diag_flag, is_spectral, b_dim, ispec);
+        return;
+    }
+
+    std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
+    std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
+    std::vector<double> *invgf = &(smpi->dynamics_invgf[ithread]);
+
+    int dim1 = EMfields->dimPrim[1];
+
+    // The projection is done directly on the total arrays
+    double* b_Jx =  &(*EMfields->Jx_ )(ibin*clrw* dim1   );
+    double* b_Jy =  &(*EMfields->Jy_ )(ibin*clrw*(dim1+1));
+    double* b_Jz =  &(*EMfields->Jz_ )(ibin*clrw* dim1   );
+    int nparts = iend-istart;
+    for ( int ipack=istart ; ipack<iend ; ipack+=vecto_size ) {
+        int npack = min( (int)vecto_size, iend-ipack );
+        currents(b_Jx , b_Jy , b_Jz , particles, ipack, npack, &(*invgf)[ipack-istart], &(*iold)[ipack-istart], &(*delta)[ipack-istart], nparts, ibin*clrw, b_dim);
+    }
+}
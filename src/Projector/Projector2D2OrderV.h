@@ -0,0 +1,41 @@
+#ifndef PROJECTOR2D2ORDERV_H
+#define PROJECTOR2D2ORDERV_H
+
+#include "Projector2D2Order.h"
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//! class Projector2D2OrderV: vectorized Esirkepov projection of the currents.
+//! Particles are processed by packs of vecto_size, one SIMD lane per particle. The contributions of a pack are
+//! reduced in a small local tile before being added to the grid. Charge densities are projected by Projector2D2Order.
+//----------------------------------------------------------------------------------------------------------------------
+class Projector2D2OrderV : public Projector2D2Order {
+public:
+    Projector2D2OrderV(Params&, Patch* patch);
+    ~Projector2D2OrderV();
+
+    //! Project global current densities (EMfields->Jx_/Jy_/Jz_) of the pack of particles [istart, istart+npack)
+    void currents(double* Jx, double* Jy, double* Jz, Particles &particles, int istart, int npack, double* invgf, int* iold, double* deltaold, int nparts, int bin, std::vector<unsigned int> &b_dim);
+
+    //!Wrapper
+    void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, bool diag_flag, bool is_spectral, std::vector<unsigned int> &b_dim, int ispec) override final;
+
+    //! Number of particles in a pack
+    static const int vecto_size = 8;
+
+private:
+    //! Size of the local tile: the 5-point stencils of a pack may spread over 2 more cells in each direction
+    static const int tile_size = 7;
+
+    //! Add a local tile of size ni x nj, located at (io,jo) in the bin, to the grid J
+    inline void add_tile(double* J, int stride, double* tile, int ni, int nj, int io, int jo)
+    {
+        for (int i=0 ; i<ni ; i++)
+            for (int j=0 ; j<nj ; j++)
+                J[(io+i)*stride + jo+j] += tile[i*tile_size+j];
+    }
+
+    double one_third;
+};
+
+#endif
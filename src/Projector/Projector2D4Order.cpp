@@ -58,10 +58,8 @@ Projector2D4Order::~Projector2D4Order()
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project current densities : main projector
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector2D4Order::operator() (double* Jx, double* Jy, double* Jz, Particles &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold)
+void Projector2D4Order::operator() (double* Jx, double* Jy, double* Jz, Particles &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold, int nparts)
 {
-    int nparts = particles.size();
-
     // -------------------------------------
     // Variable declaration & initialization
     // -------------------------------------
@@ -205,10 +203,8 @@ void Projector2D4Order::operator() (double* Jx, double* Jy, double* Jz, Particle
 // ---------------------------------------------------------------------------------------------------------------------
 //! Project current densities & charge : diagFields timstep
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector2D4Order::operator() (double* Jx, double* Jy, double* Jz, double* rho, Particles &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold)
+void Projector2D4Order::operator() (double* Jx, double* Jy, double* Jz, double* rho, Particles &particles, unsigned int ipart, double invgf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold, int nparts)
 {
-    int nparts = particles.size();
-
     // -------------------------------------
     // Variable declaration & initialization
     // -------------------------------------
@@ -470,7 +466,7 @@ void Projector2D4Order::operator() (ElectroMagn* EMfields, Particles &particles,
             double* b_Jy =  &(*EMfields->Jy_ )(ibin*clrw*(dim1+1));
             double* b_Jz =  &(*EMfields->Jz_ )(ibin*clrw*dim1);
             for (int ipart=istart ; ipart<iend; ipart++ )
-                (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);            
+                (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*invgf)[ipart-istart], ibin*clrw, b_dim, &(*iold)[ipart-istart], &(*delta)[ipart-istart], iend-istart);            
         }
         else {
             double* b_Jx =  &(*EMfields->Jx_ )(ibin*clrw* dim1   );
@@ -478,7 +474,7 @@ void Projector2D4Order::operator() (ElectroMagn* EMfields, Particles &particles,
             double* b_Jz =  &(*EMfields->Jz_ )(ibin*clrw* dim1   );
             double* b_rho=  &(*EMfields->rho_)(ibin*clrw* dim1   );
             for ( int ipart=istart ; ipart<iend; ipart++ )
-                (*this)(b_Jx , b_Jy , b_Jz , b_rho , particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+                (*this)(b_Jx , b_Jy , b_Jz , b_rho , particles,  ipart, (*invgf)[ipart-istart], ibin*clrw, b_dim, &(*iold)[ipart-istart], &(*delta)[ipart-istart], iend-istart);
         }
     // Otherwise, the projection may apply to the species-specific arrays
     } else {
@@ -487,6 +483,6 @@ void Projector2D4Order::operator() (ElectroMagn* EMfields, Particles &particles,
         double* b_Jz  = EMfields->Jz_s [ispec] ? &(*EMfields->Jz_s [ispec])(ibin*clrw* dim1   ) : &(*EMfields->Jz_ )(ibin*clrw* dim1   ) ;
         double* b_rho = EMfields->rho_s[ispec] ? &(*EMfields->rho_s[ispec])(ibin*clrw* dim1   ) : &(*EMfields->rho_)(ibin*clrw* dim1   ) ;
         for (int ipart=istart ; ipart<iend; ipart++ )
-            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*invgf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*invgf)[ipart-istart], ibin*clrw, b_dim, &(*iold)[ipart-istart], &(*delta)[ipart-istart], iend-istart);
     }
 }
@@ -0,0 +1,247 @@
+#include "Projector3D2OrderV.h"
+
+#include <cmath>
+#include <iostream>
+
+#include "ElectroMagn.h"
+#include "Field3D.h"
+#include "Particles.h"
+#include "Tools.h"
+#include "Patch.h"
+
+using namespace std;
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor for Projector3D2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Projector3D2OrderV::Projector3D2OrderV (Params& params, Patch* patch) : Projector3D2Order(params, patch)
+{
+    one_third = 1.0/3.0;
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor for Projector3D2OrderV
+// ---------------------------------------------------------------------------------------------------------------------
+Projector3D2OrderV::~Projector3D2OrderV()
+{
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Esirkepov coefficients S0 and DS = S1 - S0 of one particle in one direction
+// The 3-point stencil at current time-step is shifted by ip_m_ipo (-1, 0 or 1) in the 5-point array
+// ---------------------------------------------------------------------------------------------------------------------
+static inline void shape_factors(double deltaold, double xpn, int ip_m_ipo, int ip, double* S0, double* DS, int N, int ipart)
+{
+    double delta  = deltaold;
+    double delta2 = delta*delta;
+    S0[    ipart] = 0.;
+    S0[  N+ipart] = 0.5 * (delta2-delta+0.25);
+    S0[2*N+ipart] = 0.75-delta2;
+    S0[3*N+ipart] = 0.5 * (delta2+delta+0.25);
+    S0[4*N+ipart] = 0.;
+
+    delta  = xpn - (double)ip;
+    delta2 = delta*delta;
+    double Sm = 0.5 * (delta2-delta+0.25);
+    double S  = 0.75-delta2;
+    double Sp = 0.5 * (delta2+delta+0.25);
+    for (int i=0 ; i<5 ; i++) {
+        int k = i-2-ip_m_ipo;
+        double S1 = k==-1 ? Sm : ( k==0 ? S : ( k==1 ? Sp : 0. ) );
+        DS[i*N+ipart] = S1 - S0[i*N+ipart];
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project current densities of a pack of particles
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector3D2OrderV::currents(double* Jx, double* Jy, double* Jz, Particles &particles, int istart, int npack, int* iold, double* deltaold, int nparts, int bin, std::vector<unsigned int> &b_dim)
+{
+    const int N = vecto_size;
+
+    // Esirkepov coefficients of the pack, stored as [stencil point][particle]
+    double Sx0[5*N], Sy0[5*N], Sz0[5*N], DSx[5*N], DSy[5*N], DSz[5*N];
+    double crx[N], cry[N], crz[N];
+    int ipo[N], jpo[N], kpo[N];
+
+    double* position_x = &( particles.position(0, istart) );
+    double* position_y = &( particles.position(1, istart) );
+    double* position_z = &( particles.position(2, istart) );
+    double* weight     = &( particles.weight(istart) );
+    short*  charge     = &( particles.charge(istart) );
+
+    // --------------------------------------------------------
+    // Locate particles & Calculate Esirkepov coef. S, DS
+    // --------------------------------------------------------
+    #pragma omp simd
+    for (int ipart=0 ; ipart<npack ; ipart++) {
+        double charge_weight = (double)(charge[ipart])*weight[ipart];
+        crx[ipart] = charge_weight*dx_ov_dt;
+        cry[ipart] = charge_weight*dy_ov_dt;
+        crz[ipart] = charge_weight*dz_ov_dt;
+
+        double xpn = position_x[ipart] * dx_inv_;
+        int ip = round(xpn);
+        ipo[ipart] = iold[ipart];
+        shape_factors( deltaold[ipart], xpn, ip-ipo[ipart]-i_domain_begin, ip, Sx0, DSx, N, ipart );
+
+        double ypn = position_y[ipart] * dy_inv_;
+        int jp = round(ypn);
+        jpo[ipart] = iold[nparts+ipart];
+        shape_factors( deltaold[nparts+ipart], ypn, jp-jpo[ipart]-j_domain_begin, jp, Sy0, DSy, N, ipart );
+
+        double zpn = position_z[ipart] * dz_inv_;
+        int kp = round(zpn);
+        kpo[ipart] = iold[2*nparts+ipart];
+        shape_factors( deltaold[2*nparts+ipart], zpn, kp-kpo[ipart]-k_domain_begin, kp, Sz0, DSz, N, ipart );
+
+        // i/j/kpo stored with - i/j/k_domain_begin in Interpolator
+        //This minus 2 come from the order 2 scheme, based on a 5 points stencil from -2 to +2.
+        ipo[ipart] -= bin+2;
+        jpo[ipart] -= 2;
+        kpo[ipart] -= 2;
+    }
+
+    // ------------------------------------------------
+    // Local current created by each particle, one component at a time
+    // calculate using the charge conservation equation
+    // ------------------------------------------------
+    double bJ[125*N];
+
+    // Jx^(d,p,p) : Jx_p[i][j][k] = Jx_p[i-1][j][k] - crx_p * Wx[i-1][j][k]
+    for (int jk=0 ; jk<25 ; jk++) {
+        #pragma omp simd
+        for (int ipart=0 ; ipart<npack ; ipart++)
+            bJ[jk*N+ipart] = 0.;
+    }
+    for (int i=1 ; i<5 ; i++) {
+        for (int j=0 ; j<5 ; j++) {
+            for (int k=0 ; k<5 ; k++) {
+                #pragma omp simd
+                for (int ipart=0 ; ipart<npack ; ipart++)
+                    bJ[(i*25+j*5+k)*N+ipart] = bJ[((i-1)*25+j*5+k)*N+ipart] - crx[ipart] * DSx[(i-1)*N+ipart]
+                        * (  Sy0[j*N+ipart]*Sz0[k*N+ipart] + 0.5*DSy[j*N+ipart]*Sz0[k*N+ipart]
+                           + 0.5*DSz[k*N+ipart]*Sy0[j*N+ipart] + one_third*DSy[j*N+ipart]*DSz[k*N+ipart] );
+            }
+        }
+    }
+    add_currents( Jx, b_dim[2]*b_dim[1], b_dim[2], bJ, npack, ipo, jpo, kpo );
+
+    // Jy^(p,d,p) : Jy_p[i][j][k] = Jy_p[i][j-1][k] - cry_p * Wy[i][j-1][k]
+    for (int i=0 ; i<5 ; i++) {
+        for (int k=0 ; k<5 ; k++) {
+            #pragma omp simd
+            for (int ipart=0 ; ipart<npack ; ipart++)
+                bJ[(i*25+k)*N+ipart] = 0.;
+        }
+        for (int j=1 ; j<5 ; j++) {
+            for (int k=0 ; k<5 ; k++) {
+                #pragma omp simd
+                for (int ipart=0 ; ipart<npack ; ipart++)
+                    bJ[(i*25+j*5+k)*N+ipart] = bJ[(i*25+(j-1)*5+k)*N+ipart] - cry[ipart] * DSy[(j-1)*N+ipart]
+                        * (  Sz0[k*N+ipart]*Sx0[i*N+ipart] + 0.5*DSz[k*N+ipart]*Sx0[i*N+ipart]
+                           + 0.5*DSx[i*N+ipart]*Sz0[k*N+ipart] + one_third*DSz[k*N+ipart]*DSx[i*N+ipart] );
+            }
+        }
+    }
+    add_currents( Jy, b_dim[2]*(b_dim[1]+1), b_dim[2], bJ, npack, ipo, jpo, kpo );
+
+    // Jz^(p,p,d) : Jz_p[i][j][k] = Jz_p[i][j][k-1] - crz_p * Wz[i][j][k-1]
+    for (int i=0 ; i<5 ; i++) {
+        for (int j=0 ; j<5 ; j++) {
+            #pragma omp simd
+            for (int ipart=0 ; ipart<npack ; ipart++)
+                bJ[(i*25+j*5)*N+ipart] = 0.;
+            for (int k=1 ; k<5 ; k++) {
+                #pragma omp simd
+                for (int ipart=0 ; ipart<npack ; ipart++)
+                    bJ[(i*25+j*5+k)*N+ipart] = bJ[(i*25+j*5+k-1)*N+ipart] - crz[ipart] * DSz[(k-1)*N+ipart]
+                        * (  Sx0[i*N+ipart]*Sy0[j*N+ipart] + 0.5*DSx[i*N+ipart]*Sy0[j*N+ipart]
+                           + 0.5*DSy[j*N+ipart]*Sx0[i*N+ipart] + one_third*DSx[i*N+ipart]*DSy[j*N+ipart] );
+            }
+        }
+    }
+    add_currents( Jz, (b_dim[2]+1)*b_dim[1], b_dim[2]+1, bJ, npack, ipo, jpo, kpo );
+
+} // END Project local current densities of a pack
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Add the contributions of a pack to one component of the current
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector3D2OrderV::add_currents(double* J, int yz_size, int z_size, double* bJ, int npack, int* ipo, int* jpo, int* kpo)
+{
+    const int N = vecto_size;
+    const int T = tile_size;
+
+    int imin = ipo[0], imax = ipo[0], jmin = jpo[0], jmax = jpo[0], kmin = kpo[0], kmax = kpo[0];
+    for (int ipart=1 ; ipart<npack ; ipart++) {
+        imin = min( imin, ipo[ipart] );
+        imax = max( imax, ipo[ipart] );
+        jmin = min( jmin, jpo[ipart] );
+        jmax = max( jmax, jpo[ipart] );
+        kmin = min( kmin, kpo[ipart] );
+        kmax = max( kmax, kpo[ipart] );
+    }
+
+    if ( imax-imin <= T-5 && jmax-jmin <= T-5 && kmax-kmin <= T-5 ) {
+        // Reduce the particles of the pack in a local tile, then add the tile to the grid
+        double tJ[T*T*T];
+        for (int i=0 ; i<T*T*T ; i++)
+            tJ[i] = 0.;
+        for (int ipart=0 ; ipart<npack ; ipart++) {
+            int iloc = ( (ipo[ipart]-imin)*T + jpo[ipart]-jmin )*T + kpo[ipart]-kmin;
+            for (int i=0 ; i<5 ; i++)
+                for (int j=0 ; j<5 ; j++)
+                    for (int k=0 ; k<5 ; k++)
+                        tJ[iloc+(i*T+j)*T+k] += bJ[(i*25+j*5+k)*N+ipart];
+        }
+        for (int i=0 ; i<5+imax-imin ; i++)
+            for (int j=0 ; j<5+jmax-jmin ; j++)
+                for (int k=0 ; k<5+kmax-kmin ; k++)
+                    J[(imin+i)*yz_size + (jmin+j)*z_size + kmin+k] += tJ[(i*T+j)*T+k];
+    }
+    else {
+        // Particles of the pack are too far apart: each of them is added to the grid
+        for (int ipart=0 ; ipart<npack ; ipart++) {
+            int linindex0 = ipo[ipart]*yz_size + jpo[ipart]*z_size + kpo[ipart];
+            for (int i=0 ; i<5 ; i++)
+                for (int j=0 ; j<5 ; j++)
+                    for (int k=0 ; k<5 ; k++)
+                        J[linindex0 + i*yz_size + j*z_size + k] += bJ[(i*25+j*5+k)*N+ipart];
+        }
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Wrapper for projection
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector3D2OrderV::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, bool diag_flag, bool is_spectral, std::vector<unsigned int> &b_dim, int ispec)
+{
+    // Charge densities are only projected by the scalar projector
+    if (diag_flag || is_spectral) {
+        Projector3D2Order::operator()(EMfields, particles, smpi, istart, iend, ithread, ibin, clrw, diag_flag, is_spectral, b_dim, ispec);
+        return;
+    }
+
+    std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
+    std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
+
+    int dim1 = EMfields->dimPrim[1];
+    int dim2 = EMfields->dimPrim[2];
+
+    // The projection is done directly on the total arrays
+    double* b_Jx =  &(*EMfields->Jx_ )(ibin*clrw* dim1   * dim2   );
+    double* b_Jy =  &(*EMfields->Jy_ )(ibin*clrw*(dim1+1)* dim2   );
+    double* b_Jz =  &(*EMfields->Jz_ )(ibin*clrw* dim1   *(dim2+1));
+    int nparts = iend-istart;
+    for ( int ipack=istart ; ipack<iend ; ipack+=vecto_size ) {
+        int npack = min( (int)vecto_size, iend-ipack );
+        currents(b_Jx , b_Jy , b_Jz , particles, ipack, npack, &(*iold)[ipack-istart], &(*delta)[ipack-istart], nparts, ibin*clrw, b_dim);
+    }
+}
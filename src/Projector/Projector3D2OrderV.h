@@ -0,0 +1,38 @@
+#ifndef PROJECTOR3D2ORDERV_H
+#define PROJECTOR3D2ORDERV_H
+
+#include "Projector3D2Order.h"
+
+
+//----------------------------------------------------------------------------------------------------------------------
+//! class Projector3D2OrderV: vectorized Esirkepov projection of the currents.
+//! Particles are processed by packs of vecto_size, one SIMD lane per particle. The contributions of a pack are
+//! reduced in a small local tile, one component at a time, before being added to the grid.
+//! Charge densities are projected by Projector3D2Order.
+//----------------------------------------------------------------------------------------------------------------------
+class Projector3D2OrderV : public Projector3D2Order {
+public:
+    Projector3D2OrderV(Params&, Patch* patch);
+    ~Projector3D2OrderV();
+
+    //! Project global current densities (EMfields->Jx_/Jy_/Jz_) of the pack of particles [istart, istart+npack)
+    void currents(double* Jx, double* Jy, double* Jz, Particles &particles, int istart, int npack, int* iold, double* deltaold, int nparts, int bin, std::vector<unsigned int> &b_dim);
+
+    //!Wrapper
+    void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, bool diag_flag, bool is_spectral, std::vector<unsigned int> &b_dim, int ispec) override final;
+
+    //! Number of particles in a pack
+    static const int vecto_size = 8;
+
+private:
+    //! Size of the local tile: the 5-point stencils of a pack may spread over 2 more cells in each direction
+    static const int tile_size = 7;
+
+    //! Add the contributions bJ[125][vecto_size] of the pack to one component J of the current,
+    //! which strides are yz_size and z_size. The pack origin (ipo,jpo,kpo) is relative to the bin.
+    void add_currents(double* J, int yz_size, int z_size, double* bJ, int npack, int* ipo, int* jpo, int* kpo);
+
+    double one_third;
+};
+
+#endif
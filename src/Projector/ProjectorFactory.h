@@ -9,10 +9,8 @@
 #include "Projector3D2Order.h"
 #include "Projector3D4Order.h"
 
-#ifdef _VECTO
 #include "Projector2D2OrderV.h"
 #include "Projector3D2OrderV.h"
-#endif
 
 #include "Params.h"
 #include "Patch.h" 
@@ -38,10 +36,8 @@ public:
         else if ( ( params.geometry == "2Dcartesian" ) && ( params.interpolation_order == (unsigned int)2 ) ) {
             if (!params.vecto)
                 Proj = new Projector2D2Order(params, patch);
-#ifdef _VECTO
             else
                 Proj = new Projector2D2OrderV(params, patch);
-#endif
         }
         else if ( ( params.geometry == "2Dcartesian" ) && ( params.interpolation_order == (unsigned int)4 ) ) {
             Proj = new Projector2D4Order(params, patch);
@@ -52,10 +48,8 @@ public:
         else if ( ( params.geometry == "3Dcartesian" ) && ( params.interpolation_order == (unsigned int)2 ) ) {
             if (!params.vecto)
                 Proj = new Projector3D2Order(params, patch);
-#ifdef _VECTO
             else
                 Proj = new Projector3D2OrderV(params, patch);
-#endif
         }
         else if ( ( params.geometry == "3Dcartesian" ) && ( params.interpolation_order == (unsigned int)4 ) ) {
             Proj = new Projector3D4Order(params, patch);
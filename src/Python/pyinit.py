@@ -213,9 +213,13 @@ class Main(SmileiSingleton):
     print_every = None
     random_seed = None
     print_expected_disk_usage = True
+    aggregate_field_exchange = True
+    aggregate_particle_exchange = True
 
     # Vectorization flag
     vecto = False
+    cell_sorting = False
+    cell_sorting_every = 1
     
     def __init__(self, **kwargs):
         # Load all arguments to Main()
@@ -294,6 +298,8 @@ class LoadBalancing(SmileiSingleton):
     initial_balance = True
     cell_load = 1.0
     frozen_particle_load = 0.1
+    measured_load = True
+    load_smoothing = 0.5
 
 
 class MovingWindow(SmileiSingleton):
@@ -313,6 +319,7 @@ class Checkpoints(SmileiSingleton):
     keep_n_dumps = 2
     dump_deflate = 0
     exit_after_dump = True
+    dump_asynchronous = False
     file_grouping = None
     restart_files = []
 
@@ -372,6 +379,7 @@ class Laser(SmileiComponent):
     phase = [0., 0.]
     delay_phase = [0., 0.]
     space_time_profile = None
+    tabulation_tolerance = 1e-6
 
 class LaserEnvelope(SmileiSingleton):
     """Laser Envelope parameters"""
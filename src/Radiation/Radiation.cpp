@@ -34,6 +34,9 @@ Radiation::Radiation(Params& params, Species * species)
 
     // The thread radiated energy is initially null
     radiated_energy = 0;
+
+    // Random number generator of the species
+    rand_ = &(species->random);
 }
 
 // -----------------------------------------------------------------------------
@@ -63,7 +66,7 @@ void Radiation::compute_thread_chipa(Particles &particles,
     std::vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
     std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
 
-    int nparts = particles.size();
+    int nparts = iend-istart;
     double* Ex = &( (*Epart)[0*nparts] );
     double* Ey = &( (*Epart)[1*nparts] );
     double* Ez = &( (*Epart)[2*nparts] );
@@ -108,8 +111,8 @@ void Radiation::compute_thread_chipa(Particles &particles,
         chi[ipart] = Radiation::compute_chipa(charge_over_mass2,
                  momentum[0][ipart],momentum[1][ipart],momentum[2][ipart],
                  gamma,
-                 (*(Ex+ipart)),(*(Ey+ipart)),(*(Ez+ipart)),
-                 (*(Bx+ipart)),(*(By+ipart)),(*(Bz+ipart)) );
+                 (*(Ex+ipart-istart)),(*(Ey+ipart-istart)),(*(Ez+ipart-istart)),
+                 (*(Bx+ipart-istart)),(*(By+ipart-istart)),(*(Bz+ipart-istart)) );
 
     }
 }
@@ -122,6 +122,9 @@ class Radiation
         //! Radiated energy of the total thread
         double radiated_energy;
 
+        //! Random number generator of the radiating species
+        Random * rand_;
+
         // _________________________________________
         // Factors
 
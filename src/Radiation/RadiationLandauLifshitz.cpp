@@ -58,7 +58,7 @@ void RadiationLandauLifshitz::operator() (
     std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
     //std::vector<double> *invgf = &(smpi->dynamics_invgf[ithread]);
 
-    int nparts = particles.size();
+    int nparts = iend-istart;
     double* Ex = &( (*Epart)[0*nparts] );
     double* Ey = &( (*Epart)[1*nparts] );
     double* Ez = &( (*Epart)[2*nparts] );
@@ -117,8 +117,8 @@ void RadiationLandauLifshitz::operator() (
         chipa = Radiation::compute_chipa(charge_over_mass2,
                      momentum[0][ipart],momentum[1][ipart],momentum[2][ipart],
                      gamma,
-                     (*(Ex+ipart)),(*(Ey+ipart)),(*(Ez+ipart)),
-                     (*(Bx+ipart)),(*(By+ipart)),(*(Bz+ipart)) );
+                     (*(Ex+ipart-istart)),(*(Ey+ipart-istart)),(*(Ez+ipart-istart)),
+                     (*(Bx+ipart-istart)),(*(By+ipart-istart)),(*(Bz+ipart-istart)) );
 
         // Effect on the momentum
         if (chipa >= RadiationTables.get_chipa_radiation_threshold())
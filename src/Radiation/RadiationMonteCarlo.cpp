@@ -64,7 +64,7 @@ void RadiationMonteCarlo::operator() (
     std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
     //std::vector<double> *invgf = &(smpi->dynamics_invgf[ithread]);
 
-    int nparts = particles.size();
+    int nparts = iend-istart;
     double* Ex = &( (*Epart)[0*nparts] );
     double* Ey = &( (*Epart)[1*nparts] );
     double* Ez = &( (*Epart)[2*nparts] );
@@ -148,8 +148,8 @@ void RadiationMonteCarlo::operator() (
             chipa = Radiation::compute_chipa(charge_over_mass2,
                      momentum[0][ipart],momentum[1][ipart],momentum[2][ipart],
                      gamma,
-                     (*(Ex+ipart)),(*(Ey+ipart)),(*(Ez+ipart)),
-                     (*(Bx+ipart)),(*(By+ipart)),(*(Bz+ipart)) );
+                     (*(Ex+ipart-istart)),(*(Ey+ipart-istart)),(*(Ez+ipart-istart)),
+                     (*(Bx+ipart-istart)),(*(By+ipart-istart)),(*(Bz+ipart-istart)) );
 
             // Update the quantum parameter in species
             // chi[ipart] = chipa;
@@ -163,7 +163,7 @@ void RadiationMonteCarlo::operator() (
             {
                 // New final optical depth to reach for emision
                 while (tau[ipart] <= epsilon_tau)
-                   tau[ipart] = -log(1.-Rand::uniform());
+                   tau[ipart] = -log(1.-rand_->uniform());
 
             }
 
@@ -281,7 +281,7 @@ void RadiationMonteCarlo::photon_emission(int ipart,
     //double new_norm_p;
 
     // Get the photon quantum parameter from the table xip
-    chiph = RadiationTables.compute_chiph_emission(chipa);
+    chiph = RadiationTables.compute_chiph_emission(chipa, rand_);
 
     // compute the photon gamma factor
     gammaph = chiph/chipa*(gammapa-1.0);
@@ -60,7 +60,7 @@ void RadiationNiel::operator() (
     std::vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
     std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
 
-    int nparts = particles.size();
+    int nparts = iend-istart;
     double* Ex = &( (*Epart)[0*nparts] );
     double* Ey = &( (*Epart)[1*nparts] );
     double* Ez = &( (*Epart)[2*nparts] );
@@ -161,20 +161,8 @@ void RadiationNiel::operator() (
     }*/
 
     // Vectorized computation of the random number in a uniform distribution
-    #pragma omp simd
-    for (ipart=0 ; ipart < nbparticles; ipart++ )
-    {
-
-        // Below chipa = chipa_radiation_threshold, radiation losses are negligible
-        if (chipa[ipart] > chipa_radiation_threshold)
-        {
-
-          // Pick a random number in the normal distribution of standard
-          // deviation sqrt(dt) (variance dt)
-          //random_numbers[ipart] = 2.*Rand::uniform() -1.;
-          random_numbers[ipart] = 2.*drand48() -1.;
-        }
-    }
+    // (drawn for all particles so that the stream does not depend on chipa)
+    rand_->uniform2( random_numbers, nbparticles );
 
     // Vectorized computation of the random number in a normal distribution
     double p;
@@ -1185,8 +1185,9 @@ void RadiationTables::output_tables(SmileiMPI *smpi)
 //! ramdomly and using the tables xip and chiphmin
 //
 //! \param chipa particle quantum parameter
+//! \param rand random number generator
 // -----------------------------------------------------------------------------
-double RadiationTables::compute_chiph_emission(double chipa)
+double RadiationTables::compute_chiph_emission(double chipa, Random * rand)
 {
     // Log10 of chipa
     double logchipa;
@@ -1226,7 +1227,7 @@ double RadiationTables::compute_chiph_emission(double chipa)
     // ---------------------------------------
 
     // First, we compute a random xip in [0,1[
-    xip = Rand::uniform();
+    xip = rand->uniform();
 
     // If the randomly computed xip if below the first one of the row,
     // we take the first one which corresponds to the minimal photon chiph
@@ -1541,7 +1542,8 @@ double RadiationTables::get_h_Niel_from_table(double chipa)
 // -----------------------------------------------------------------------------
 double RadiationTables::get_Niel_stochastic_term(double gamma,
                                                  double chipa,
-                                                 double sqrtdt)
+                                                 double sqrtdt,
+                                                 Random * rand)
 {
     // Get the value of h for the corresponding chipa
     double h,r;
@@ -1550,7 +1552,7 @@ double RadiationTables::get_Niel_stochastic_term(double gamma,
 
     // Pick a random number in the normal distribution of standard
     // deviation sqrt(dt) (variance dt)
-    r = Rand::normal(sqrtdt);
+    r = rand->normal(sqrtdt);
 
     /*std::random_device device;
     std::mt19937 gen(device());
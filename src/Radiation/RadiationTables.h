@@ -19,6 +19,7 @@
 
 #include "Params.h"
 #include "H5.h"
+#include "Random.h"
 
 //------------------------------------------------------------------------------
 //! RadiationTables class: holds parameters, tables and functions to compute
@@ -69,7 +70,8 @@ class RadiationTables
         //! Computation of the photon quantum parameter chiph for emission
         //! ramdomly and using the tables xip and chiphmin
         //! \param chipa particle quantum parameter
-        double compute_chiph_emission(double chipa);
+        //! \param rand random number generator
+        double compute_chiph_emission(double chipa, Random * rand);
 
         //! Return the value of the function h(chipa) of Niel et al.
         //! Use an integration of Gauss-Legendre
@@ -89,9 +91,11 @@ class RadiationTables
         //! \param gamma particle Lorentz factor
         //! \param chipa particle quantum parameter
         //! \param dt time step
+        //! \param rand random number generator
         double get_Niel_stochastic_term(double gamma,
                                         double chipa,
-                                        double dt);
+                                        double dt,
+                                        Random * rand);
 
         //! Computation of the corrected continuous quantum radiated energy
         //! during dt from the quantum parameter chipa using the Ridgers
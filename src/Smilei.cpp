@@ -362,9 +362,10 @@ int main (int argc, char* argv[])
             // ----------------------------------------------------------------------
             // Validate restart  : to do
             // Restart patched moving window : to do
+            timers.checkpoint.restart();
             #pragma omp master
             checkpoint.dump(vecPatches, itime, &smpi, simWindow, params);
-            #pragma omp barrier
+            timers.checkpoint.update( params.printNow( itime ) );
             // ----------------------------------------------------------------------
             
             
@@ -394,6 +395,8 @@ int main (int argc, char* argv[])
         
     } //End omp parallel region
 
+    // Wait for the last asynchronous dump
+    checkpoint.waitDump();
     smpi.barrier();
 
     // ------------------------------------------------------------------
@@ -404,6 +407,8 @@ int main (int argc, char* argv[])
 
     TITLE("Time profiling : (print time > 0.001%)");
     timers.profile(&smpi);
+    if( checkpoint.dump_asynchronous && checkpoint.async_write_time > 0. )
+        MESSAGE(0, "\n\t Asynchronous dumps written by the I/O thread in " << checkpoint.async_write_time << " s (master process)" );
 
 /*tommaso
     // ------------------------------------------------------------------
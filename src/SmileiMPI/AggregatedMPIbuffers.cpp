@@ -0,0 +1,573 @@
+#include "AggregatedMPIbuffers.h"
+
+#include <cstring>
+#include <map>
+#include <algorithm>
+
+#include "Field.h"
+#include "Patch.h"
+#include "VectorPatch.h"
+#include "Species.h"
+#include "Particles.h"
+
+using namespace std;
+
+AggregatedMPIbuffers::AggregatedMPIbuffers( MPI_Comm comm, int tag ) :
+    comm_( comm ),
+    tag_( tag )
+{
+    for (int iDim=0 ; iDim<3 ; iDim++) {
+        sum_[iDim] = false;
+        oversize_[iDim] = 0;
+        nComp_[iDim] = 0;
+        patch_size_[iDim] = 0;
+    }
+}
+
+
+AggregatedMPIbuffers::~AggregatedMPIbuffers()
+{
+    for (int iDim=0 ; iDim<3 ; iDim++)
+        freeMessages( iDim );
+}
+
+
+void AggregatedMPIbuffers::initExchange( std::vector<Field*>& fields, VectorPatch& vecPatches )
+{
+    for (unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++)
+        initExchange( fields, vecPatches, iDim );
+}
+
+
+void AggregatedMPIbuffers::finalizeExchange( std::vector<Field*>& fields, VectorPatch& vecPatches )
+{
+    for (unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++)
+        finalizeExchange( fields, vecPatches, iDim );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Pack the slabs along iDim and start the persistent requests
+// Called by all threads : packing is shared between threads, MPI calls are made by a single thread
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::initExchange( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim )
+{
+    #pragma omp single
+    setup( fields, vecPatches, iDim, false );
+
+    pack( fields, vecPatches, iDim );
+
+    #pragma omp single
+    {
+        if (requests_[iDim].size()>0)
+            MPI_Startall( requests_[iDim].size(), &requests_[iDim][0] );
+    }
+}
+
+
+void AggregatedMPIbuffers::finalizeExchange( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim )
+{
+    #pragma omp single
+    {
+        if (requests_[iDim].size()>0)
+            MPI_Waitall( requests_[iDim].size(), &requests_[iDim][0], MPI_STATUSES_IGNORE );
+    }
+
+    unpack( fields, vecPatches, iDim );
+}
+
+
+void AggregatedMPIbuffers::initSumField( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim )
+{
+    #pragma omp single
+    setup( fields, vecPatches, iDim, true );
+
+    pack( fields, vecPatches, iDim );
+
+    #pragma omp single
+    {
+        if (requests_[iDim].size()>0)
+            MPI_Startall( requests_[iDim].size(), &requests_[iDim][0] );
+    }
+}
+
+
+void AggregatedMPIbuffers::finalizeSumField( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim )
+{
+    finalizeExchange( fields, vecPatches, iDim );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Build the messages along iDim
+//   - a patch having an MPI neighbor through side iNeighbor sends its slab to, and receives the neighbor's slab from,
+//     this side : the slabs of all patches are grouped per neighbor process and per side
+//   - the sender orders the slabs by its Hilbert indexes, the receiver sorts its patches by the Hilbert indexes
+//     of their neighbors : both sides of a message then list the same pairs of patches in the same order
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::setup( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim, bool sum )
+{
+    unsigned int nPatches = vecPatches.size();
+    unsigned int nComp = fields.size()/nPatches;
+
+    // Nothing to do if the fields and the neighborhood of the patches did not change
+    vector<unsigned int> signature;
+    signature.push_back( sum );
+    signature.push_back( nComp );
+    for (unsigned int icomp=0 ; icomp<nComp ; icomp++) {
+        Field* field = fields[icomp*nPatches];
+        for (unsigned int i=0 ; i<field->dims_.size() ; i++) {
+            signature.push_back( field->dims_[i] );
+            signature.push_back( field->isDual_[i] );
+        }
+    }
+    for (unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++) {
+        Patch* patch = vecPatches(ipatch);
+        signature.push_back( patch->hindex );
+        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+            signature.push_back( patch->neighbor_[iDim][iNeighbor] );
+            signature.push_back( patch->MPI_neighbor_[iDim][iNeighbor] );
+        }
+    }
+    if (signature == signature_[iDim]) return;
+
+    freeMessages( iDim );
+    signature_[iDim] = signature;
+    sum_[iDim] = sum;
+    oversize_[iDim] = vecPatches(0)->EMfields->oversize[iDim];
+    nComp_[iDim] = nComp;
+
+    patch_size_[iDim] = 0;
+    for (unsigned int icomp=0 ; icomp<nComp ; icomp++) {
+        Field* field = fields[icomp*nPatches];
+        unsigned int istart, width;
+        slab( field, iDim, 0, true, istart, width );
+        unsigned int size = width;
+        for (unsigned int i=0 ; i<field->dims_.size() ; i++)
+            if ((int)i != iDim) size *= field->dims_[i];
+        patch_size_[iDim] += size;
+    }
+
+    for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+        map<int, vector<unsigned int> > send_patches;
+        map<int, vector< pair<unsigned int, unsigned int> > > recv_patches;
+        for (unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++) {
+            Patch* patch = vecPatches(ipatch);
+            if (patch->is_a_MPI_neighbor( iDim, iNeighbor )) {
+                send_patches[ patch->MPI_neighbor_[iDim][iNeighbor] ].push_back( ipatch );
+                recv_patches[ patch->MPI_neighbor_[iDim][iNeighbor] ].push_back( make_pair( patch->neighbor_[iDim][iNeighbor], ipatch ) );
+            }
+        }
+
+        for (map<int, vector<unsigned int> >::iterator it=send_patches.begin() ; it!=send_patches.end() ; it++) {
+            Message message;
+            message.rank = it->first;
+            message.side = iNeighbor;
+            message.patches = it->second;
+            send_[iDim].push_back( message );
+        }
+        for (map<int, vector< pair<unsigned int, unsigned int> > >::iterator it=recv_patches.begin() ; it!=recv_patches.end() ; it++) {
+            sort( it->second.begin(), it->second.end() );
+            Message message;
+            message.rank = it->first;
+            message.side = iNeighbor;
+            for (unsigned int i=0 ; i<it->second.size() ; i++)
+                message.patches.push_back( it->second[i].second );
+            recv_[iDim].push_back( message );
+        }
+    }
+
+    // Buffers and persistent requests
+    // The tag identifies the synchronization, the direction and the side of the sending patches
+    unsigned int nSend = send_[iDim].size();
+    requests_[iDim].resize( nSend + recv_[iDim].size() );
+    for (unsigned int imsg=0 ; imsg<nSend ; imsg++) {
+        Message& message = send_[iDim][imsg];
+        message.buffer.resize( message.patches.size()*patch_size_[iDim] );
+        int tag = 6*tag_ + 2*iDim + message.side;
+        MPI_Send_init( message.buffer.data(), message.buffer.size(), MPI_DOUBLE, message.rank, tag, comm_, &requests_[iDim][imsg] );
+        for (unsigned int i=0 ; i<message.patches.size() ; i++)
+            send_items_[iDim].push_back( make_pair( imsg, i ) );
+    }
+    for (unsigned int imsg=0 ; imsg<recv_[iDim].size() ; imsg++) {
+        Message& message = recv_[iDim][imsg];
+        message.buffer.resize( message.patches.size()*patch_size_[iDim] );
+        int tag = 6*tag_ + 2*iDim + (message.side+1)%2;
+        MPI_Recv_init( message.buffer.data(), message.buffer.size(), MPI_DOUBLE, message.rank, tag, comm_, &requests_[iDim][nSend+imsg] );
+        for (unsigned int i=0 ; i<message.patches.size() ; i++)
+            recv_items_[iDim].push_back( make_pair( imsg, i ) );
+    }
+}
+
+
+void AggregatedMPIbuffers::freeMessages( int iDim )
+{
+    for (unsigned int i=0 ; i<requests_[iDim].size() ; i++)
+        MPI_Request_free( &requests_[iDim][i] );
+    requests_[iDim].clear();
+    send_[iDim].clear();
+    recv_[iDim].clear();
+    send_items_[iDim].clear();
+    recv_items_[iDim].clear();
+    signature_[iDim].clear();
+}
+
+
+void AggregatedMPIbuffers::pack( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim )
+{
+    unsigned int nPatches = vecPatches.size();
+
+    #pragma omp for schedule(static)
+    for (unsigned int iitem=0 ; iitem<send_items_[iDim].size() ; iitem++) {
+        Message& message = send_[iDim][ send_items_[iDim][iitem].first ];
+        unsigned int ipatch = message.patches[ send_items_[iDim][iitem].second ];
+        double* buffer = &( message.buffer[ send_items_[iDim][iitem].second * patch_size_[iDim] ] );
+        for (unsigned int icomp=0 ; icomp<nComp_[iDim] ; icomp++) {
+            Field* field = fields[icomp*nPatches+ipatch];
+            unsigned int istart, width;
+            slab( field, iDim, message.side, true, istart, width );
+            buffer += copySlab( field, iDim, istart, width, buffer, pack_slab );
+        }
+    }
+}
+
+
+void AggregatedMPIbuffers::unpack( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim )
+{
+    unsigned int nPatches = vecPatches.size();
+
+    #pragma omp for schedule(static)
+    for (unsigned int iitem=0 ; iitem<recv_items_[iDim].size() ; iitem++) {
+        Message& message = recv_[iDim][ recv_items_[iDim][iitem].first ];
+        unsigned int ipatch = message.patches[ recv_items_[iDim][iitem].second ];
+        double* buffer = &( message.buffer[ recv_items_[iDim][iitem].second * patch_size_[iDim] ] );
+        for (unsigned int icomp=0 ; icomp<nComp_[iDim] ; icomp++) {
+            Field* field = fields[icomp*nPatches+ipatch];
+            unsigned int istart, width;
+            slab( field, iDim, message.side, false, istart, width );
+            buffer += copySlab( field, iDim, istart, width, buffer, sum_[iDim] ? add_slab : copy_slab );
+        }
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Same slabs as Patch::initExchange and Patch::initSumField
+//   - exchange : the oversize cells next to the ghost cells are sent, the ghost cells are received
+//   - sum      : the 2*oversize+1 (+1 if dual) cells shared with the neighbor are sent and received
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::slab( Field* field, int iDim, int side, bool send, unsigned int& istart, unsigned int& width )
+{
+    unsigned int n      = field->dims_[iDim];
+    unsigned int isDual = field->isDual_[iDim];
+    if (sum_[iDim]) {
+        width  = 2*oversize_[iDim] + 1 + isDual;
+        istart = side * ( n - width );
+    }
+    else {
+        width = oversize_[iDim];
+        if (send)
+            istart = side * ( n - (2*oversize_[iDim]+1+isDual) ) + (1-side) * ( oversize_[iDim] + 1 + isDual );
+        else
+            istart = side * ( n - oversize_[iDim] );
+    }
+}
+
+
+unsigned int AggregatedMPIbuffers::copySlab( Field* field, int iDim, unsigned int istart, unsigned int width, double* buffer, int mode )
+{
+    unsigned int n[3] = { 1, 1, 1 };
+    for (unsigned int i=0 ; i<field->dims_.size() ; i++)
+        n[i] = field->dims_[i];
+    unsigned int imin[3] = { 0, 0, 0 };
+    unsigned int imax[3] = { n[0], n[1], n[2] };
+    imin[iDim] = istart;
+    imax[iDim] = istart + width;
+
+    // The slab is copied by contiguous rows along the last dimension
+    unsigned int nrow = imax[2] - imin[2];
+    double* pt = buffer;
+    for (unsigned int ix=imin[0] ; ix<imax[0] ; ix++) {
+        for (unsigned int iy=imin[1] ; iy<imax[1] ; iy++) {
+            double* row = &( field->data_[ (ix*n[1]+iy)*n[2] + imin[2] ] );
+            if (mode == pack_slab)
+                memcpy( pt, row, nrow*sizeof(double) );
+            else if (mode == copy_slab)
+                memcpy( row, pt, nrow*sizeof(double) );
+            else
+                for (unsigned int iz=0 ; iz<nrow ; iz++)
+                    row[iz] += pt[iz];
+            pt += nrow;
+        }
+    }
+    return pt - buffer;
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// ---------------------------------------------------------------------------------------------------------------------
+// ---------------------------------------------       PARTICLES         -----------------------------------------------
+// ---------------------------------------------------------------------------------------------------------------------
+// ---------------------------------------------------------------------------------------------------------------------
+
+AggregatedSpeciesMPIbuffers::AggregatedSpeciesMPIbuffers( MPI_Comm comm, int ispec ) :
+    comm_( comm ),
+    ispec_( ispec ),
+    nDouble_( 0 ),
+    nShort_( 0 ),
+    nUint64_( 0 ),
+    record_size_( 0 )
+{
+}
+
+
+AggregatedSpeciesMPIbuffers::~AggregatedSpeciesMPIbuffers()
+{
+    for (int iDim=0 ; iDim<3 ; iDim++)
+        freeMessages( iDim );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// First phase : numbers of particles
+// Called by all threads after Patch::initCommParticles
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedSpeciesMPIbuffers::initCounts( VectorPatch& vecPatches, int iDim )
+{
+    #pragma omp single
+    {
+        setup( vecPatches, iDim );
+
+        for (unsigned int imsg=0 ; imsg<send_[iDim].size() ; imsg++) {
+            Message& message = send_[iDim][imsg];
+            for (unsigned int i=0 ; i<message.patches.size() ; i++)
+                message.counts[i] = vecPatches(message.patches[i])->vecSpecies[ispec_]->MPIbuff.part_index_send_sz[iDim][message.side];
+        }
+
+        if (count_requests_[iDim].size()>0)
+            MPI_Startall( count_requests_[iDim].size(), &count_requests_[iDim][0] );
+    }
+}
+
+
+void AggregatedSpeciesMPIbuffers::finalizeCounts( VectorPatch& vecPatches, int iDim )
+{
+    #pragma omp single
+    {
+        if (count_requests_[iDim].size()>0)
+            MPI_Waitall( count_requests_[iDim].size(), &count_requests_[iDim][0], MPI_STATUSES_IGNORE );
+    }
+
+    #pragma omp for schedule(static)
+    for (unsigned int iitem=0 ; iitem<recv_items_[iDim].size() ; iitem++) {
+        Message& message = recv_[iDim][ recv_items_[iDim][iitem].first ];
+        unsigned int i = recv_items_[iDim][iitem].second;
+        Species* species = vecPatches(message.patches[i])->vecSpecies[ispec_];
+        species->MPIbuff.part_index_recv_sz[iDim][message.side] = message.counts[i];
+        if (message.counts[i]!=0)
+            species->MPIbuff.partRecv[iDim][message.side].initialize( message.counts[i], *(species->particles) );
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Second phase : particles
+// Called by all threads after Patch::CommParticles (which applies the periodicity to the particles to send)
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedSpeciesMPIbuffers::initParticles( VectorPatch& vecPatches, int iDim )
+{
+    #pragma omp single
+    {
+        setRecordLayout( vecPatches );
+        computeOffsets( send_[iDim] );
+        computeOffsets( recv_[iDim] );
+
+        // Sizes are known from the first phase : receives are posted before packing
+        requests_[iDim].clear();
+        for (unsigned int imsg=0 ; imsg<recv_[iDim].size() ; imsg++) {
+            Message& message = recv_[iDim][imsg];
+            if (message.buffer.size()==0) continue;
+            MPI_Request request;
+            int tag = 12*ispec_ + 6 + 2*iDim + (message.side+1)%2;
+            MPI_Irecv( message.buffer.data(), message.buffer.size(), MPI_DOUBLE, message.rank, tag, comm_, &request );
+            requests_[iDim].push_back( request );
+        }
+    }
+
+    #pragma omp for schedule(static)
+    for (unsigned int iitem=0 ; iitem<send_items_[iDim].size() ; iitem++) {
+        Message& message = send_[iDim][ send_items_[iDim][iitem].first ];
+        unsigned int i = send_items_[iDim][iitem].second;
+        Species* species = vecPatches(message.patches[i])->vecSpecies[ispec_];
+        Particles& particles = *(species->particles);
+        std::vector<int>& indexes = species->MPIbuff.part_index_send[iDim][message.side];
+
+        double* record = message.buffer.data() + message.first[i]*record_size_;
+        for (int j=0 ; j<message.counts[i] ; j++) {
+            unsigned int ipart = indexes[j];
+            unsigned int k = 0;
+            for (unsigned int iprop=0 ; iprop<nDouble_ ; iprop++)
+                record[k++] = (*particles.double_prop[iprop])[ipart];
+            for (unsigned int iprop=0 ; iprop<nUint64_ ; iprop++)
+                memcpy( &record[k++], &(*particles.uint64_prop[iprop])[ipart], sizeof(uint64_t) );
+            for (unsigned int iprop=0 ; iprop<nShort_ ; iprop++)
+                memcpy( (char*)(&record[k]) + iprop*sizeof(short), &(*particles.short_prop[iprop])[ipart], sizeof(short) );
+            record += record_size_;
+        }
+    }
+
+    #pragma omp single
+    {
+        for (unsigned int imsg=0 ; imsg<send_[iDim].size() ; imsg++) {
+            Message& message = send_[iDim][imsg];
+            if (message.buffer.size()==0) continue;
+            MPI_Request request;
+            int tag = 12*ispec_ + 6 + 2*iDim + message.side;
+            MPI_Isend( message.buffer.data(), message.buffer.size(), MPI_DOUBLE, message.rank, tag, comm_, &request );
+            requests_[iDim].push_back( request );
+        }
+    }
+}
+
+
+void AggregatedSpeciesMPIbuffers::finalizeParticles( VectorPatch& vecPatches, int iDim )
+{
+    #pragma omp single
+    {
+        if (requests_[iDim].size()>0)
+            MPI_Waitall( requests_[iDim].size(), &requests_[iDim][0], MPI_STATUSES_IGNORE );
+        requests_[iDim].clear();
+    }
+
+    #pragma omp for schedule(static)
+    for (unsigned int iitem=0 ; iitem<recv_items_[iDim].size() ; iitem++) {
+        Message& message = recv_[iDim][ recv_items_[iDim][iitem].first ];
+        unsigned int i = recv_items_[iDim][iitem].second;
+        Species* species = vecPatches(message.patches[i])->vecSpecies[ispec_];
+        // Sized by finalizeCounts
+        Particles& particles = species->MPIbuff.partRecv[iDim][message.side];
+
+        double* record = message.buffer.data() + message.first[i]*record_size_;
+        for (int j=0 ; j<message.counts[i] ; j++) {
+            unsigned int k = 0;
+            for (unsigned int iprop=0 ; iprop<nDouble_ ; iprop++)
+                (*particles.double_prop[iprop])[j] = record[k++];
+            for (unsigned int iprop=0 ; iprop<nUint64_ ; iprop++)
+                memcpy( &(*particles.uint64_prop[iprop])[j], &record[k++], sizeof(uint64_t) );
+            for (unsigned int iprop=0 ; iprop<nShort_ ; iprop++)
+                memcpy( &(*particles.short_prop[iprop])[j], (char*)(&record[k]) + iprop*sizeof(short), sizeof(short) );
+            record += record_size_;
+        }
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Build the messages along iDim, paired as in AggregatedMPIbuffers::setup
+// Only the numbers of particles use persistent requests : the size of the particle messages changes at each exchange
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedSpeciesMPIbuffers::setup( VectorPatch& vecPatches, int iDim )
+{
+    unsigned int nPatches = vecPatches.size();
+
+    // Nothing to do if the neighborhood of the patches did not change
+    vector<int> signature;
+    for (unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++) {
+        Patch* patch = vecPatches(ipatch);
+        signature.push_back( patch->hindex );
+        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+            signature.push_back( patch->neighbor_[iDim][iNeighbor] );
+            signature.push_back( patch->MPI_neighbor_[iDim][iNeighbor] );
+        }
+    }
+    if (signature == signature_[iDim]) return;
+
+    freeMessages( iDim );
+    signature_[iDim] = signature;
+
+    for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+        map<int, vector<unsigned int> > send_patches;
+        map<int, vector< pair<int, unsigned int> > > recv_patches;
+        for (unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++) {
+            Patch* patch = vecPatches(ipatch);
+            if (patch->is_a_MPI_neighbor( iDim, iNeighbor )) {
+                send_patches[ patch->MPI_neighbor_[iDim][iNeighbor] ].push_back( ipatch );
+                recv_patches[ patch->MPI_neighbor_[iDim][iNeighbor] ].push_back( make_pair( patch->neighbor_[iDim][iNeighbor], ipatch ) );
+            }
+        }
+
+        for (map<int, vector<unsigned int> >::iterator it=send_patches.begin() ; it!=send_patches.end() ; it++) {
+            Message message;
+            message.rank = it->first;
+            message.side = iNeighbor;
+            message.patches = it->second;
+            send_[iDim].push_back( message );
+        }
+        for (map<int, vector< pair<int, unsigned int> > >::iterator it=recv_patches.begin() ; it!=recv_patches.end() ; it++) {
+            sort( it->second.begin(), it->second.end() );
+            Message message;
+            message.rank = it->first;
+            message.side = iNeighbor;
+            for (unsigned int i=0 ; i<it->second.size() ; i++)
+                message.patches.push_back( it->second[i].second );
+            recv_[iDim].push_back( message );
+        }
+    }
+
+    unsigned int nSend = send_[iDim].size();
+    count_requests_[iDim].resize( nSend + recv_[iDim].size() );
+    for (unsigned int imsg=0 ; imsg<nSend ; imsg++) {
+        Message& message = send_[iDim][imsg];
+        message.counts.resize( message.patches.size(), 0 );
+        message.first.resize( message.patches.size()+1, 0 );
+        int tag = 12*ispec_ + 2*iDim + message.side;
+        MPI_Send_init( message.counts.data(), message.counts.size(), MPI_INT, message.rank, tag, comm_, &count_requests_[iDim][imsg] );
+        for (unsigned int i=0 ; i<message.patches.size() ; i++)
+            send_items_[iDim].push_back( make_pair( imsg, i ) );
+    }
+    for (unsigned int imsg=0 ; imsg<recv_[iDim].size() ; imsg++) {
+        Message& message = recv_[iDim][imsg];
+        message.counts.resize( message.patches.size(), 0 );
+        message.first.resize( message.patches.size()+1, 0 );
+        int tag = 12*ispec_ + 2*iDim + (message.side+1)%2;
+        MPI_Recv_init( message.counts.data(), message.counts.size(), MPI_INT, message.rank, tag, comm_, &count_requests_[iDim][nSend+imsg] );
+        for (unsigned int i=0 ; i<message.patches.size() ; i++)
+            recv_items_[iDim].push_back( make_pair( imsg, i ) );
+    }
+}
+
+
+void AggregatedSpeciesMPIbuffers::freeMessages( int iDim )
+{
+    for (unsigned int i=0 ; i<count_requests_[iDim].size() ; i++)
+        MPI_Request_free( &count_requests_[iDim][i] );
+    count_requests_[iDim].clear();
+    requests_[iDim].clear();
+    send_[iDim].clear();
+    recv_[iDim].clear();
+    send_items_[iDim].clear();
+    recv_items_[iDim].clear();
+    signature_[iDim].clear();
+}
+
+
+void AggregatedSpeciesMPIbuffers::computeOffsets( std::vector<Message>& messages )
+{
+    for (unsigned int imsg=0 ; imsg<messages.size() ; imsg++) {
+        Message& message = messages[imsg];
+        for (unsigned int i=0 ; i<message.patches.size() ; i++)
+            message.first[i+1] = message.first[i] + message.counts[i];
+        // resize never decreases the capacity
+        message.buffer.resize( message.first.back()*record_size_ );
+    }
+}
+
+
+void AggregatedSpeciesMPIbuffers::setRecordLayout( VectorPatch& vecPatches )
+{
+    Particles& particles = *(vecPatches(0)->vecSpecies[ispec_]->particles);
+    nDouble_ = particles.double_prop.size();
+    nUint64_ = particles.uint64_prop.size();
+    nShort_  = particles.short_prop.size();
+    record_size_ = nDouble_ + nUint64_ + ( nShort_*sizeof(short) + sizeof(double)-1 ) / sizeof(double);
+}
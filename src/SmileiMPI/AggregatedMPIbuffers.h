@@ -0,0 +1,160 @@
+#ifndef AGGREGATEDMPIBUFFERS_H
+#define AGGREGATEDMPIBUFFERS_H
+
+#include <mpi.h>
+#include <vector>
+
+class Field;
+class VectorPatch;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class AggregatedMPIbuffers : field synchronization with one message per neighbor MPI process
+//!
+//! The slabs of all the patches (and of all the field components) which go to the same MPI process through the same
+//! side are packed in a single buffer, instead of one message per patch and per field in Patch::initExchange.
+//! The messages use persistent requests, which are set up again only when the patch distribution or the exchanged
+//! fields change. Intra-MPI process synchronizations are still managed by memcpy in SyncVectorPatch.
+//  --------------------------------------------------------------------------------------------------------------------
+class AggregatedMPIbuffers {
+public:
+    //! tag identifies the synchronization (E, B, J ...) : several of them can be in progress at the same time
+    AggregatedMPIbuffers( MPI_Comm comm, int tag );
+    ~AggregatedMPIbuffers();
+
+    //! Send the cells of fields which are ghost cells of the neighbor patches, along all directions
+    //!   - fields : all components (Ex then Ey then Ez ...) for all patches of vecPatches
+    void initExchange( std::vector<Field*>& fields, VectorPatch& vecPatches );
+    //! Wait for the messages of initExchange and copy the received cells in the ghost cells
+    void finalizeExchange( std::vector<Field*>& fields, VectorPatch& vecPatches );
+
+    //! Same as initExchange, along iDim only
+    void initExchange( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim );
+    //! Same as finalizeExchange, along iDim only
+    void finalizeExchange( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim );
+
+    //! Send the cells of fields shared with the neighbor patches along iDim, to be summed
+    void initSumField( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim );
+    //! Wait for the messages of initSumField and add the received cells
+    void finalizeSumField( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim );
+
+private:
+    //! Slabs sent to, or received from, the MPI process rank through the given side of the patches
+    struct Message {
+        int rank;
+        int side;
+        //! Local patches, sorted by Hilbert index of the sending patches
+        std::vector<unsigned int> patches;
+        std::vector<double> buffer;
+    };
+
+    //! Build the messages along iDim, unless they are already built for the same fields and patch distribution
+    void setup( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim, bool sum );
+    //! Free the messages along iDim
+    void freeMessages( int iDim );
+
+    //! Pack the slabs of all messages sent along iDim
+    void pack( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim );
+    //! Copy (or add if sum) the slabs of all messages received along iDim
+    void unpack( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim );
+    //! First cell and width along iDim of the slab exchanged through side
+    void slab( Field* field, int iDim, int side, bool send, unsigned int& istart, unsigned int& width );
+
+    //! Mode of copySlab
+    enum { pack_slab, copy_slab, add_slab };
+    //! Copy the cells [istart, istart+width[ along iDim of field to buffer (pack_slab), or from buffer
+    //! Returns the number of cells of the slab
+    static unsigned int copySlab( Field* field, int iDim, unsigned int istart, unsigned int width, double* buffer, int mode );
+
+    MPI_Comm comm_;
+    int tag_;
+
+    //! Fields and patch distribution for which the messages along each direction are built
+    std::vector<unsigned int> signature_[3];
+    //! True if the messages along each direction are used for a sum
+    bool sum_[3];
+    //! Ghost size along each direction
+    unsigned int oversize_[3];
+    //! Number of components of the exchanged fields
+    unsigned int nComp_[3];
+    //! Number of cells exchanged by a patch (all components) along each direction
+    unsigned int patch_size_[3];
+
+    std::vector<Message> send_[3];
+    std::vector<Message> recv_[3];
+    //! Persistent requests along each direction : all sends, then all receives
+    std::vector<MPI_Request> requests_[3];
+    //! (message, patch in message) : flat lists to share packing and unpacking between threads
+    std::vector< std::pair<unsigned int, unsigned int> > send_items_[3];
+    std::vector< std::pair<unsigned int, unsigned int> > recv_items_[3];
+};
+
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class AggregatedSpeciesMPIbuffers : particle exchange of a species with one message per neighbor MPI process
+//!
+//! The exchange has two phases along each direction. The numbers of particles sent by the patches are sent first, with
+//! persistent requests. Then the particles of all the patches which go to the same MPI process through the same side
+//! are packed in a single buffer, with a fixed record per particle : no MPI datatype is created, and the size of the
+//! messages is known by the receiver without probing. Intra-MPI process exchanges are still done in Patch::CommParticles.
+//  --------------------------------------------------------------------------------------------------------------------
+class AggregatedSpeciesMPIbuffers {
+public:
+    //! Each species has its own tags : the exchanges of several species can be in progress at the same time
+    AggregatedSpeciesMPIbuffers( MPI_Comm comm, int ispec );
+    ~AggregatedSpeciesMPIbuffers();
+
+    //! Send part_index_send_sz of the patches along iDim
+    void initCounts( VectorPatch& vecPatches, int iDim );
+    //! Receive part_index_recv_sz of the patches along iDim, and size their receive buffers partRecv
+    void finalizeCounts( VectorPatch& vecPatches, int iDim );
+
+    //! Pack the particles listed in part_index_send of the patches along iDim, and send them
+    void initParticles( VectorPatch& vecPatches, int iDim );
+    //! Receive the particles along iDim and unpack them in partRecv
+    void finalizeParticles( VectorPatch& vecPatches, int iDim );
+
+private:
+    //! Particles sent to, or received from, the MPI process rank through the given side of the patches
+    struct Message {
+        int rank;
+        int side;
+        //! Local patches, sorted by Hilbert index of the sending patches
+        std::vector<unsigned int> patches;
+        //! Number of particles of each patch
+        std::vector<int> counts;
+        //! First record of each patch in buffer
+        std::vector<unsigned int> first;
+        //! Particle records : the capacity is kept from one exchange to the next
+        std::vector<double> buffer;
+    };
+
+    //! Build the messages along iDim, unless they are already built for the same patch distribution
+    void setup( VectorPatch& vecPatches, int iDim );
+    //! Free the messages along iDim
+    void freeMessages( int iDim );
+    //! Number of particles of each message, and first record of each patch
+    void computeOffsets( std::vector<Message>& messages );
+    //! Record of a particle : all double properties, then the uint64 properties, then the short properties (4 per double)
+    void setRecordLayout( VectorPatch& vecPatches );
+
+    MPI_Comm comm_;
+    int ispec_;
+
+    //! Number of properties of each type, and size of a record in doubles
+    unsigned int nDouble_, nShort_, nUint64_, record_size_;
+
+    //! Patch distribution for which the messages along each direction are built
+    std::vector<int> signature_[3];
+
+    std::vector<Message> send_[3];
+    std::vector<Message> recv_[3];
+    //! Persistent requests of the numbers of particles along each direction : all sends, then all receives
+    std::vector<MPI_Request> count_requests_[3];
+    //! Requests of the particles along each direction
+    std::vector<MPI_Request> requests_[3];
+    //! (message, patch in message) : flat lists to share packing and unpacking between threads
+    std::vector< std::pair<unsigned int, unsigned int> > send_items_[3];
+    std::vector< std::pair<unsigned int, unsigned int> > recv_items_[3];
+};
+
+#endif
@@ -17,6 +17,7 @@
 #include "Field.h"
 
 #include "Species.h"
+#include "Collisions.h"
 #include "PeekAtSpecies.h"
 #include "Hilbert_functions.h"
 #include "VectorPatch.h"
@@ -57,6 +58,10 @@ SmileiMPI::SmileiMPI( int* argc, char*** argv )
     MPI_Comm_size( SMILEI_COMM_WORLD, &smilei_sz );
     MPI_Comm_rank( SMILEI_COMM_WORLD, &smilei_rk );
 
+    // Messages of AggregatedMPIbuffers, whose tags could match the tags of the patch messages
+    MPI_Comm_dup( SMILEI_COMM_WORLD, &SMILEI_COMM_FIELDS );
+    MPI_Comm_dup( SMILEI_COMM_WORLD, &SMILEI_COMM_PARTICLES );
+
 } // END SmileiMPI::SmileiMPI
 
 
@@ -68,6 +73,8 @@ SmileiMPI::~SmileiMPI()
 {
     delete[]periods_;
 
+    MPI_Comm_free( &SMILEI_COMM_FIELDS );
+    MPI_Comm_free( &SMILEI_COMM_PARTICLES );
     MPI_Finalize();
 
 } // END SmileiMPI::~SmileiMPI
@@ -362,10 +369,62 @@ void SmileiMPI::recompute_patch_count( Params& params, VectorPatch& vecpatches,
     Ncur = 0; // Number of patches assigned to current rank r.
 
     //Compute Local Loads of each Patch (Lp)
+    //Frozen particles are kept apart: they are not measured, their load is always frozen_particle_load.
+    std::vector<double> Lparticles(patch_count[smilei_rk], 0.), Lfrozen(patch_count[smilei_rk], 0.);
     for(unsigned int ipatch=0; ipatch < (unsigned int)patch_count[smilei_rk]; ipatch++){
         for (unsigned int ispecies = 0; ispecies < tot_species_number; ispecies++) {
-            Lp[ipatch] += vecpatches(ipatch)->vecSpecies[ispecies]->getNbrOfParticles()*(1+(params.frozen_particle_load-1)*(time_dual < vecpatches(ipatch)->vecSpecies[ispecies]->time_frozen)) ;
+            if (time_dual < vecpatches(ipatch)->vecSpecies[ispecies]->time_frozen)
+                Lfrozen[ipatch] += vecpatches(ipatch)->vecSpecies[ispecies]->getNbrOfParticles()*params.frozen_particle_load ;
+            else
+                Lparticles[ipatch] += vecpatches(ipatch)->vecSpecies[ispecies]->getNbrOfParticles() ;
+        }
+    }
+
+    //Replace the particle count by the time measured since the last balancing, if any.
+    //The measured times are averaged over the timesteps the patch was measured (patches created by
+    //the moving window exist only for a part of the interval), then converted to particle loads using
+    //the average time per particle, so that cell_load keeps its meaning. The result is smoothed over
+    //successive balancings. Patches not measured yet keep the estimate from their number of particles.
+    if (params.measured_load) {
+        std::vector<double> Tpatch(patch_count[smilei_rk], 0.);
+        double sums_loc[2] = {0., 0.}, sums[2];
+        for(unsigned int ipatch=0; ipatch < (unsigned int)patch_count[smilei_rk]; ipatch++){
+            Patch * patch = vecpatches(ipatch);
+            for (unsigned int ispecies = 0; ispecies < tot_species_number; ispecies++) {
+                Tpatch[ipatch] += patch->vecSpecies[ispecies]->measured_time;
+                patch->vecSpecies[ispecies]->measured_time = 0.;
+            }
+            for (unsigned int icoll = 0; icoll < patch->vecCollisions.size(); icoll++) {
+                Tpatch[ipatch] += patch->vecCollisions[icoll]->measured_time;
+                patch->vecCollisions[icoll]->measured_time = 0.;
+            }
+            if (patch->measured_steps > 0) {
+                Tpatch[ipatch] /= patch->measured_steps;
+                sums_loc[0] += Tpatch[ipatch];
+                sums_loc[1] += Lparticles[ipatch];
+            }
+        }
+        MPI_Allreduce(sums_loc, sums, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+        if (sums[0] > 0. && sums[1] > 0.) {
+            double load_per_second = sums[1] / sums[0];
+            for(unsigned int ipatch=0; ipatch < (unsigned int)patch_count[smilei_rk]; ipatch++){
+                Patch * patch = vecpatches(ipatch);
+                if (patch->measured_steps == 0) continue;
+                double load = Tpatch[ipatch] * load_per_second;
+                if (patch->measured_load < 0.)
+                    patch->measured_load = load;
+                else
+                    patch->measured_load = params.load_smoothing*load + (1.-params.load_smoothing)*patch->measured_load;
+                Lparticles[ipatch] = patch->measured_load;
+            }
         }
+    }
+    for(unsigned int ipatch=0; ipatch < (unsigned int)patch_count[smilei_rk]; ipatch++)
+        vecpatches(ipatch)->measured_steps = 0;
+
+    for(unsigned int ipatch=0; ipatch < (unsigned int)patch_count[smilei_rk]; ipatch++){
+        Lp[ipatch] += Lparticles[ipatch] + Lfrozen[ipatch];
         Tload_loc += Lp[ipatch];
     }
 
@@ -124,6 +124,18 @@ public:
         return SMILEI_COMM_WORLD;
     }
 
+    //! Return the communicator of the field synchronizations aggregated per MPI process
+    inline MPI_Comm getFieldsComm()
+    {
+        return SMILEI_COMM_FIELDS;
+    }
+
+    //! Return the communicator of the particle exchanges aggregated per MPI process
+    inline MPI_Comm getParticlesComm()
+    {
+        return SMILEI_COMM_PARTICLES;
+    }
+
     //! Return MPI_Comm_size
     inline int getOMPMaxThreads() {
         return smilei_omp_max_threads;
@@ -132,6 +144,9 @@ public:
     
     // Global buffers for vectorization of Species::dynamics
     // -----------------------------------------------------
+    // They only hold the particles of the bin being processed: the particle ipart
+    // of the bin [istart, iend[ is stored at ipart-istart, with a stride iend-istart
+    // between components.
 
     //! value of the Efield 
     std::vector<std::vector<double>> dynamics_Epart;
@@ -144,8 +159,11 @@ public:
     //! delta_old_pos
     std::vector<std::vector<double>> dynamics_deltaold;
 
-    // Resize buffers for a given number of particles
+    // Resize buffers for a given number of particles (they never shrink, so that
+    // the allocation only happens for the largest bin)
     inline void dynamics_resize(int ithread, int ndim_part, int npart ){
+        if( (int)dynamics_invgf[ithread].size() >= npart
+         && (int)dynamics_iold[ithread].size() >= ndim_part*npart ) return;
         dynamics_Epart[ithread].resize(3*npart);
         dynamics_Bpart[ithread].resize(3*npart);
         dynamics_invgf[ithread].resize(npart);
@@ -168,6 +186,10 @@ public:
 protected:
     //! Global MPI Communicator
     MPI_Comm SMILEI_COMM_WORLD;
+    //! Duplicate of SMILEI_COMM_WORLD for the field synchronizations aggregated per MPI process
+    MPI_Comm SMILEI_COMM_FIELDS;
+    //! Duplicate of SMILEI_COMM_WORLD for the particle exchanges aggregated per MPI process
+    MPI_Comm SMILEI_COMM_PARTICLES;
 
     //! Number of MPI process in the current communicator
     int smilei_sz;
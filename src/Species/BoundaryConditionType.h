@@ -82,13 +82,13 @@ inline int thermalize_particle( Particles &particles, int ipart, int direction,
                 // change of velocity in the direction normal to the reflection plane
                 double sign_vel = -particles.momentum(i,ipart)/std::abs(particles.momentum(i,ipart));
                 particles.momentum(i,ipart) = sign_vel * species->thermalMomentum[i]
-                *                             std::sqrt( -std::log(1.0-Rand::uniform1()) );
+                *                             std::sqrt( -std::log(1.0-species->random.uniform1()) );
 
             } else {
                 // change of momentum in the direction(s) along the reflection plane
-                double sign_rnd = Rand::uniform() - 0.5; sign_rnd = (sign_rnd)/std::abs(sign_rnd);
+                double sign_rnd = species->random.uniform() - 0.5; sign_rnd = (sign_rnd)/std::abs(sign_rnd);
                 particles.momentum(i,ipart) = sign_rnd * species->thermalMomentum[i]
-                *                             userFunctions::erfinv( Rand::uniform1() );
+                *                             userFunctions::erfinv( species->random.uniform1() );
             }//if
 
         }//i
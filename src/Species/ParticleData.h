@@ -78,19 +78,22 @@ public:
     };
     
     // Expose a vector to numpy
-    inline PyArrayObject* vector2numpy( std::vector<double> &vec ) {
+    template <class A>
+    inline PyArrayObject* vector2numpy( std::vector<double, A> &vec ) {
         return (PyArrayObject*) PyArray_SimpleNewFromData(1, dims, NPY_DOUBLE, (double*)(&vec[start]));
     };
-    inline PyArrayObject* vector2numpy( std::vector<uint64_t> &vec ) {
+    template <class A>
+    inline PyArrayObject* vector2numpy( std::vector<uint64_t, A> &vec ) {
         return (PyArrayObject*) PyArray_SimpleNewFromData(1, dims, NPY_UINT64, (uint64_t*)(&vec[start]));
     };
-    inline PyArrayObject* vector2numpy( std::vector<short> &vec ) {
+    template <class A>
+    inline PyArrayObject* vector2numpy( std::vector<short, A> &vec ) {
         return (PyArrayObject*) PyArray_SimpleNewFromData(1, dims, NPY_SHORT, (short*)(&vec[start]));
     };
     
     // Add a C++ vector as an attribute, but exposed as a numpy array
-    template <typename T>
-    inline void setVectorAttr( std::vector<T> &vec, std::string name ) {
+    template <typename T, class A>
+    inline void setVectorAttr( std::vector<T, A> &vec, std::string name ) {
         PyArrayObject* numpy_vector = vector2numpy( vec );
         PyObject_SetAttrString(particles, name.c_str(), (PyObject*)numpy_vector);
         attrs.push_back( numpy_vector );
@@ -113,14 +113,16 @@ void Particles::initialize(unsigned int nParticles, Particles &part)
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::reserve( unsigned int n_part_max, unsigned int nDim )
 {
-    return;
+    if ( n_part_max <= Weight.capacity() ) return;
 
     Position.resize(nDim);
-    Position_old.resize(nDim);
-    for (unsigned int i=0 ; i< nDim ; i++) {
+    for (unsigned int i=0 ; i< nDim ; i++)
         Position[i].reserve(n_part_max);
+#ifdef  __DEBUG
+    Position_old.resize(nDim);
+    for (unsigned int i=0 ; i< nDim ; i++)
         Position_old[i].reserve(n_part_max);
-    }
+#endif
     Momentum.resize(3);
     for (unsigned int i=0 ; i< 3 ; i++) {
         Momentum[i].reserve(n_part_max);
@@ -139,6 +141,16 @@ void Particles::reserve( unsigned int n_part_max, unsigned int nDim )
 
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Make room for nAdditionalParticles: all the arrays are reallocated at once, by at least half of the current capacity
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::grow( unsigned int nAdditionalParticles )
+{
+    unsigned int n_part_max = size() + nAdditionalParticles;
+    if ( n_part_max <= capacity() ) return;
+    reserve( max( n_part_max, capacity() + capacity()/2 ), dimension() );
+}
+
 void Particles::resize( unsigned int nParticles, unsigned int nDim )
 {
     Position.resize(nDim);
@@ -177,13 +189,13 @@ void Particles::shrink_to_fit( unsigned int nDim )
 {
 
     for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ )
-        std::vector<double>( *double_prop[iprop] ).swap( *double_prop[iprop] );
+        aligned_vector<double>( *double_prop[iprop] ).swap( *double_prop[iprop] );
 
     for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ )
-        std::vector<short>( *short_prop[iprop] ).swap( *short_prop[iprop] );
+        aligned_vector<short>( *short_prop[iprop] ).swap( *short_prop[iprop] );
 
     for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ )
-        std::vector<uint64_t>( *uint64_prop[iprop] ).swap( *uint64_prop[iprop] );
+        aligned_vector<uint64_t>( *uint64_prop[iprop] ).swap( *uint64_prop[iprop] );
 }
 
 
@@ -514,6 +526,53 @@ void Particles::overwrite_part(unsigned int part1, Particles &dest_parts, unsign
         (*dest_parts.uint64_prop[iprop])[part2] = (*uint64_prop[iprop])[part1];
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Move all particles into dest vector at the locations given by dest_index. Properties are processed one by one.
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::overwrite_parts(Particles &dest_parts, vector<int> &dest_index)
+{
+    unsigned int npart = dest_index.size();
+    int* index = &dest_index[0];
+
+    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) {
+        double* src  = &(*double_prop[iprop])[0];
+        double* dest = &(*dest_parts.double_prop[iprop])[0];
+        for ( unsigned int ipart=0 ; ipart<npart ; ipart++ )
+            dest[index[ipart]] = src[ipart];
+    }
+
+    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
+        short* src  = &(*short_prop[iprop])[0];
+        short* dest = &(*dest_parts.short_prop[iprop])[0];
+        for ( unsigned int ipart=0 ; ipart<npart ; ipart++ )
+            dest[index[ipart]] = src[ipart];
+    }
+
+    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ ) {
+        uint64_t* src  = &(*uint64_prop[iprop])[0];
+        uint64_t* dest = &(*dest_parts.uint64_prop[iprop])[0];
+        for ( unsigned int ipart=0 ; ipart<npart ; ipart++ )
+            dest[index[ipart]] = src[ipart];
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Exchange the content of two Particles (no copy)
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::swap(Particles &part)
+{
+    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ )
+        double_prop[iprop]->swap( *part.double_prop[iprop] );
+
+    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ )
+        short_prop[iprop]->swap( *part.short_prop[iprop] );
+
+    for ( unsigned int iprop=0 ; iprop<uint64_prop.size() ; iprop++ )
+        uint64_prop[iprop]->swap( *part.uint64_prop[iprop] );
+
+    cell_keys.swap( part.cell_keys );
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Move particle part1->part1+N into part2->part2+N memory location of dest vector, erasing part2->part2+N.
 // ---------------------------------------------------------------------------------------------------------------------
@@ -579,6 +638,8 @@ void Particles::push_to_end(unsigned int iPart )
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::create_particle()
 {
+    grow( 1 );
+
     for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ )
         (*double_prop[iprop]).push_back(0.);
 
@@ -595,6 +656,8 @@ void Particles::create_particle()
 void Particles::create_particles(int nAdditionalParticles )
 {
     int nParticles = size();
+    grow( nAdditionalParticles );
+
     for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ )
         (*double_prop[iprop]).resize(nParticles+nAdditionalParticles,0.);
 
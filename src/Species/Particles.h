@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "Tools.h"
+#include "AlignedAllocator.h"
 #include "TimeSelection.h"
 
 class Particle;
@@ -35,9 +36,12 @@ public:
     //! Create nParticles null particles of nDim size
     void initialize(unsigned int nParticles, Particles &part );
 
-    //! Set capacity of Particles vectors
+    //! Set capacity of Particles vectors (never decreases it)
     void reserve( unsigned int n_part_max, unsigned int nDim );
 
+    //! Make room for nAdditionalParticles, growing the capacity geometrically
+    void grow( unsigned int nAdditionalParticles );
+
     //! Resize Particles vectors
     void resize( unsigned int nParticles, unsigned int nDim );
 
@@ -108,6 +112,12 @@ public:
     //! Overwrite particle part1 into part2 of dest_parts memory location. Erasing part2
     void overwrite_part(unsigned int part1, Particles &dest_parts, unsigned int part2);
 
+    //! Overwrite all particles into dest_parts at the locations given by dest_index (dest_parts must have the same properties)
+    void overwrite_parts(Particles &dest_parts, std::vector<int> &dest_index);
+
+    //! Exchange the content of two Particles having the same properties
+    void swap(Particles &part);
+
 
     //! Move iPart at the end of vectors
     void push_to_end(unsigned int iPart );
@@ -140,7 +150,7 @@ public:
     }
 
     //! Method used to get the list of Particle position
-    inline std::vector<double>  position(unsigned int idim) const {
+    inline aligned_vector<double>  position(unsigned int idim) const {
         return Position[idim];
     }
 
@@ -153,7 +163,7 @@ public:
         return Momentum[idim][ipart];
     }
       //! Method used to get the Particle momentum
-    inline std::vector<double>  momentum( unsigned int idim ) const {
+    inline aligned_vector<double>  momentum( unsigned int idim ) const {
         return Momentum[idim];
     }
 
@@ -166,7 +176,7 @@ public:
         return Weight[ipart];
     }
     //! Method used to get the Particle weight
-    inline std::vector<double>  weight() const {
+    inline aligned_vector<double>  weight() const {
         return Weight;
     }
 
@@ -179,7 +189,7 @@ public:
         return Charge[ipart];
     }
     //! Method used to get the list of Particle charges
-    inline std::vector<short>  charge() const {
+    inline aligned_vector<short>  charge() const {
         return Charge;
     }
 
@@ -202,31 +212,31 @@ public:
     //! Partiles properties, respect type order : all double, all short, all unsigned int
 
     //! array containing the particle position
-    std::vector< std::vector<double> > Position;
+    std::vector< aligned_vector<double> > Position;
 
     //! array containing the particle former (old) positions
-    std::vector< std::vector<double> >Position_old;
+    std::vector< aligned_vector<double> > Position_old;
 
     //! array containing the particle moments
-    std::vector< std::vector<double> >  Momentum;
+    std::vector< aligned_vector<double> > Momentum;
 
     //! containing the particle weight: equivalent to a charge density
-    std::vector<double> Weight;
+    aligned_vector<double> Weight;
 
     //! containing the particle quantum parameter
-    std::vector<double> Chi;
+    aligned_vector<double> Chi;
 
     //! charge state of the particle (multiples of e>0)
-    std::vector<short> Charge;
+    aligned_vector<short> Charge;
 
     //! Id of the particle
-    std::vector<uint64_t> Id;
+    aligned_vector<uint64_t> Id;
 
     // Discontinuous radiation losses
 
     //! Incremental optical depth for
     //! the Monte-Carlo process
-    std::vector<double> Tau;
+    aligned_vector<double> Tau;
     
     //! cell_keys of the particle
     std::vector<int> cell_keys;
@@ -252,7 +262,7 @@ public:
         return Id[ipart];
     }
     //! Method used to get the Particle Ids
-    inline std::vector<uint64_t> id() const {
+    inline aligned_vector<uint64_t> id() const {
         return Id;
     }
     void sortById();
@@ -275,7 +285,7 @@ public:
         return Chi[ipart];
     }
     //! Method used to get the Particle chi factor
-    inline std::vector<double>  chi() const {
+    inline aligned_vector<double>  chi() const {
         return Chi;
     }
 
@@ -289,14 +299,41 @@ public:
         return Tau[ipart];
     }
     //! Method used to get the Particle optical depth
-    inline std::vector<double>  tau() const {
+    inline aligned_vector<double>  tau() const {
         return Tau;
     }
 
+    //! Raw pointers to the particle arrays (the first particle of each array is aligned on 64 bytes)
+    inline double* getPtrPosition( unsigned int idim ) {
+        return Position[idim].data();
+    }
+    inline double* getPtrPositionOld( unsigned int idim ) {
+        return Position_old[idim].data();
+    }
+    inline double* getPtrMomentum( unsigned int idim ) {
+        return Momentum[idim].data();
+    }
+    inline double* getPtrWeight() {
+        return Weight.data();
+    }
+    inline short* getPtrCharge() {
+        return Charge.data();
+    }
+    inline double* getPtrChi() {
+        return Chi.data();
+    }
+    inline double* getPtrTau() {
+        return Tau.data();
+    }
+    inline uint64_t* getPtrId() {
+        return Id.data();
+    }
+
 
-    std::vector< std::vector<double  >*> double_prop;
-    std::vector< std::vector<short   >*> short_prop;
-    std::vector< std::vector<uint64_t>*> uint64_prop;
+    //! Pointers to all the properties in use, by type
+    std::vector< aligned_vector<double  >*> double_prop;
+    std::vector< aligned_vector<short   >*> short_prop;
+    std::vector< aligned_vector<uint64_t>*> uint64_prop;
 
 
     //bool test_move( int iPartStart, int iPartEnd, Params& params );
@@ -319,13 +356,13 @@ public:
     Particle operator()(unsigned int iPart);
 
     //! Methods to obtain any property, given its index in the arrays double_prop, uint64_prop, or short_prop
-    void getProperty(unsigned int iprop, std::vector<uint64_t>* &prop) {
+    void getProperty(unsigned int iprop, aligned_vector<uint64_t>* &prop) {
         prop = uint64_prop[iprop];
     }
-    void getProperty(unsigned int iprop, std::vector<short>* &prop) {
+    void getProperty(unsigned int iprop, aligned_vector<short>* &prop) {
         prop = short_prop[iprop];
     }
-    void getProperty(unsigned int iprop, std::vector<double>* &prop) {
+    void getProperty(unsigned int iprop, aligned_vector<double>* &prop) {
         prop = double_prop[iprop];
     }
 
@@ -37,18 +37,18 @@ void PusherBoris::operator() (Particles &particles, SmileiMPI* smpi, int istart,
 
     double* momentum[3];
     for ( int i = 0 ; i<3 ; i++ )
-        momentum[i] =  &( particles.momentum(i,0) );
+        momentum[i] =  particles.getPtrMomentum(i);
     double* position[3];
     for ( int i = 0 ; i<nDim_ ; i++ )
-        position[i] =  &( particles.position(i,0) );
+        position[i] =  particles.getPtrPosition(i);
 #ifdef  __DEBUG
     double* position_old[3];
     for ( int i = 0 ; i<nDim_ ; i++ )
-        position_old[i] =  &( particles.position_old(i,0) );
+        position_old[i] =  particles.getPtrPositionOld(i);
 #endif
-    short* charge = &( particles.charge(0) );
+    short* charge = particles.getPtrCharge();
 
-    int nparts = particles.size();
+    int nparts = iend-istart;
     double* Ex = &( (*Epart)[0*nparts] );
     double* Ey = &( (*Epart)[1*nparts] );
     double* Ez = &( (*Epart)[2*nparts] );
@@ -61,9 +61,9 @@ void PusherBoris::operator() (Particles &particles, SmileiMPI* smpi, int istart,
         charge_over_mass_dts2 = (double)(charge[ipart])*one_over_mass_*dts2;
 
         // init Half-acceleration in the electric field
-        pxsm = charge_over_mass_dts2*(*(Ex+ipart));
-        pysm = charge_over_mass_dts2*(*(Ey+ipart));
-        pzsm = charge_over_mass_dts2*(*(Ez+ipart));
+        pxsm = charge_over_mass_dts2*(*(Ex+ipart-istart));
+        pysm = charge_over_mass_dts2*(*(Ey+ipart-istart));
+        pzsm = charge_over_mass_dts2*(*(Ez+ipart-istart));
 
         //(*this)(particles, ipart, (*Epart)[ipart], (*Bpart)[ipart] , (*invgf)[ipart]);
         umx = momentum[0][ipart] + pxsm;
@@ -73,9 +73,9 @@ void PusherBoris::operator() (Particles &particles, SmileiMPI* smpi, int istart,
 
         // Rotation in the magnetic field
         alpha = charge_over_mass_dts2*local_invgf;
-        Tx    = alpha * (*(Bx+ipart));
-        Ty    = alpha * (*(By+ipart));
-        Tz    = alpha * (*(Bz+ipart));
+        Tx    = alpha * (*(Bx+ipart-istart));
+        Ty    = alpha * (*(By+ipart-istart));
+        Tz    = alpha * (*(Bz+ipart-istart));
         Tx2   = Tx*Tx;
         Ty2   = Ty*Ty;
         Tz2   = Tz*Tz;
@@ -92,7 +92,7 @@ void PusherBoris::operator() (Particles &particles, SmileiMPI* smpi, int istart,
         pxsm += upx;
         pysm += upy;
         pzsm += upz;
-        (*invgf)[ipart] = 1. / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        (*invgf)[ipart-istart] = 1. / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
 
         momentum[0][ipart] = pxsm;
         momentum[1][ipart] = pysm;
@@ -104,7 +104,7 @@ void PusherBoris::operator() (Particles &particles, SmileiMPI* smpi, int istart,
           position_old[i][ipart] = position[i][ipart];
 #endif
         for ( int i = 0 ; i<nDim_ ; i++ ) 
-            position[i][ipart]     += dt*momentum[i][ipart]*(*invgf)[ipart];
+            position[i][ipart]     += dt*momentum[i][ipart]*(*invgf)[ipart-istart];
 
     }
 }
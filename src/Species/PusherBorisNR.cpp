@@ -25,7 +25,7 @@ void PusherBorisNR::operator() (Particles &particles, SmileiMPI* smpi, int istar
     std::vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
     std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
 
-    int nparts = particles.size();
+    int nparts = iend-istart;
     double* Ex = &( (*Epart)[0*nparts] );
     double* Ey = &( (*Epart)[1*nparts] );
     double* Ez = &( (*Epart)[2*nparts] );
@@ -47,16 +47,16 @@ void PusherBorisNR::operator() (Particles &particles, SmileiMPI* smpi, int istar
         alpha = charge_over_mass_*dts2;
 
         // uminus = v + q/m * dt/2 * E
-        umx = particles.momentum(0, ipart) * one_over_mass_ + alpha * (*(Ex+ipart));
-        umy = particles.momentum(1, ipart) * one_over_mass_ + alpha * (*(Ey+ipart));
-        umz = particles.momentum(2, ipart) * one_over_mass_ + alpha * (*(Ez+ipart));
+        umx = particles.momentum(0, ipart) * one_over_mass_ + alpha * (*(Ex+ipart-istart));
+        umy = particles.momentum(1, ipart) * one_over_mass_ + alpha * (*(Ey+ipart-istart));
+        umz = particles.momentum(2, ipart) * one_over_mass_ + alpha * (*(Ez+ipart-istart));
 
 
         // Rotation in the magnetic field
 
-        Tx    = alpha * (*(Bx+ipart));
-        Ty    = alpha * (*(By+ipart));
-        Tz    = alpha * (*(Bz+ipart));
+        Tx    = alpha * (*(Bx+ipart-istart));
+        Ty    = alpha * (*(By+ipart-istart));
+        Tz    = alpha * (*(Bz+ipart-istart));
 
         T2 = Tx*Tx + Ty*Ty + Tz*Tz;
 
@@ -70,9 +70,9 @@ void PusherBorisNR::operator() (Particles &particles, SmileiMPI* smpi, int istar
         upz = umz + umx*Sy - umy*Sx;
 
 
-        particles.momentum(0, ipart) = mass_ * (upx + alpha*(*(Ex+ipart)));
-        particles.momentum(1, ipart) = mass_ * (upy + alpha*(*(Ey+ipart)));
-        particles.momentum(2, ipart) = mass_ * (upz + alpha*(*(Ez+ipart)));
+        particles.momentum(0, ipart) = mass_ * (upx + alpha*(*(Ex+ipart-istart)));
+        particles.momentum(1, ipart) = mass_ * (upy + alpha*(*(Ey+ipart-istart)));
+        particles.momentum(2, ipart) = mass_ * (upz + alpha*(*(Ez+ipart-istart)));
 
         // Move the particle
         for ( int i = 0 ; i<nDim_ ; i++ )
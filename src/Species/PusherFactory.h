@@ -46,12 +46,12 @@ public:
             // assign the correct Pusher to Push
             if ( species->pusher == "boris")
             {
-                if (!params.vecto)
-                    Push = new PusherBoris( params, species );
 #ifdef _VECTO
-                else
+                if (params.vecto)
                     Push = new PusherBorisV( params, species );
+                else
 #endif
+                    Push = new PusherBoris( params, species );
             }
             else if ( species->pusher == "borisnr" )
             {
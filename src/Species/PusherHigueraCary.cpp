@@ -35,7 +35,7 @@ void PusherHigueraCary::operator() (Particles &particles, SmileiMPI* smpi, int i
     std::vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
     std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
 
-    int nparts = particles.size();
+    int nparts = iend-istart;
     double* Ex = &( (*Epart)[0*nparts] );
     double* Ey = &( (*Epart)[1*nparts] );
     double* Ez = &( (*Epart)[2*nparts] );
@@ -54,25 +54,25 @@ void PusherHigueraCary::operator() (Particles &particles, SmileiMPI* smpi, int i
 
     double* momentum[3];
     for ( int i = 0 ; i<3 ; i++ )
-        momentum[i] =  &( particles.momentum(i,0) );
+        momentum[i] =  particles.getPtrMomentum(i);
     double* position[3];
     for ( int i = 0 ; i<nDim_ ; i++ )
-        position[i] =  &( particles.position(i,0) );
+        position[i] =  particles.getPtrPosition(i);
 #ifdef  __DEBUG
     double* position_old[3];
     for ( int i = 0 ; i<nDim_ ; i++ )
-        position_old[i] =  &( particles.position_old(i,0) );
+        position_old[i] =  particles.getPtrPositionOld(i);
 #endif
-    short* charge = &( particles.charge(0) );
+    short* charge = particles.getPtrCharge();
 
 #pragma omp simd
     for (int ipart=istart ; ipart<iend; ipart++ ) {
         charge_over_mass_dts2 = (double)(charge[ipart])*one_over_mass_*dts2;
 
         // init Half-acceleration in the electric field
-        pxsm = charge_over_mass_dts2*(*(Ex+ipart));
-        pysm = charge_over_mass_dts2*(*(Ey+ipart));
-        pzsm = charge_over_mass_dts2*(*(Ez+ipart));
+        pxsm = charge_over_mass_dts2*(*(Ex+ipart-istart));
+        pysm = charge_over_mass_dts2*(*(Ey+ipart-istart));
+        pzsm = charge_over_mass_dts2*(*(Ez+ipart-istart));
 
         //(*this)(particles, ipart, (*Epart)[ipart], (*Bpart)[ipart] , (*invgf)[ipart]);
         umx = momentum[0][ipart] + pxsm;
@@ -84,9 +84,9 @@ void PusherHigueraCary::operator() (Particles &particles, SmileiMPI* smpi, int i
         gfm2 = ( 1.0 + umx*umx + umy*umy + umz*umz );
 
         // Equivalent of betax,betay,betaz in the paper
-        Tx    = charge_over_mass_dts2 * (*(Bx+ipart));
-        Ty    = charge_over_mass_dts2 * (*(By+ipart));
-        Tz    = charge_over_mass_dts2 * (*(Bz+ipart));
+        Tx    = charge_over_mass_dts2 * (*(Bx+ipart-istart));
+        Ty    = charge_over_mass_dts2 * (*(By+ipart-istart));
+        Tz    = charge_over_mass_dts2 * (*(Bz+ipart-istart));
 
         // beta**2
         beta2 = Tx*Tx + Ty*Ty + Tz*Tz;        
@@ -117,7 +117,7 @@ void PusherHigueraCary::operator() (Particles &particles, SmileiMPI* smpi, int i
         pzsm += upz;
 
         // final gamma factor
-        (*invgf)[ipart] = 1. / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        (*invgf)[ipart-istart] = 1. / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
 
         momentum[0][ipart] = pxsm;
         momentum[1][ipart] = pysm;
@@ -129,7 +129,7 @@ void PusherHigueraCary::operator() (Particles &particles, SmileiMPI* smpi, int i
             position_old[i][ipart] = position[i][ipart];
 #endif
         for ( int i = 0 ; i<nDim_ ; i++ ) 
-            position[i][ipart]     += dt*momentum[i][ipart]*(*invgf)[ipart];
+            position[i][ipart]     += dt*momentum[i][ipart]*(*invgf)[ipart-istart];
 
     }
 }
@@ -37,20 +37,20 @@ void PusherPhoton::operator() (Particles &particles, SmileiMPI* smpi,
 
     double* momentum[3];
     for ( int i = 0 ; i<3 ; i++ )
-        momentum[i] =  &( particles.momentum(i,0) );
+        momentum[i] =  particles.getPtrMomentum(i);
     double* position[3];
     for ( int i = 0 ; i<nDim_ ; i++ )
-        position[i] =  &( particles.position(i,0) );
+        position[i] =  particles.getPtrPosition(i);
 #ifdef  __DEBUG
     double* position_old[3];
     for ( int i = 0 ; i<nDim_ ; i++ )
-        position_old[i] =  &( particles.position_old(i,0) );
+        position_old[i] =  particles.getPtrPositionOld(i);
 #endif
 
     #pragma omp simd
     for (int ipart=istart ; ipart<iend; ipart++ ) {
 
-        (*invgf)[ipart] = 1. / sqrt( momentum[0][ipart]*momentum[0][ipart] +
+        (*invgf)[ipart-istart] = 1. / sqrt( momentum[0][ipart]*momentum[0][ipart] +
                                      momentum[1][ipart]*momentum[1][ipart] +
                                      momentum[2][ipart]*momentum[2][ipart] );
 
@@ -60,7 +60,7 @@ void PusherPhoton::operator() (Particles &particles, SmileiMPI* smpi,
             position_old[i][ipart] = position[i][ipart];
 #endif
         for ( int i = 0 ; i<nDim_ ; i++ )
-            position[i][ipart]     += dt*momentum[i][ipart]*(*invgf)[ipart];
+            position[i][ipart]     += dt*momentum[i][ipart]*(*invgf)[ipart-istart];
             
     }
 }
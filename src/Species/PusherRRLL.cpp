@@ -85,7 +85,7 @@ void PusherRRLL::operator() (Particles &particles, SmileiMPI* smpi, int istart,
 {
     std::vector<double> *Epart = &(smpi->dynamics_Epart[ithread]);
     std::vector<double> *Bpart = &(smpi->dynamics_Bpart[ithread]);
-    int nparts = particles.size();
+    int nparts = iend-istart;
     double* Ex = &( (*Epart)[0*nparts] );
     double* Ey = &( (*Epart)[1*nparts] );
     double* Ez = &( (*Epart)[2*nparts] );
@@ -105,16 +105,16 @@ void PusherRRLL::operator() (Particles &particles, SmileiMPI* smpi, int istart,
         //(*this)(particles, iPart, (*Epart)[iPart], (*Bpart)[iPart] , (*invgf)[iPart]);
         charge_over_mass_ = static_cast<double>(particles.charge(ipart))*one_over_mass_;
         // Half-acceleration in the electric field
-        umx = particles.momentum(0, ipart) + charge_over_mass_*(*(Ex+ipart))*dts2;
-        umy = particles.momentum(1, ipart) + charge_over_mass_*(*(Ey+ipart))*dts2;
-        umz = particles.momentum(2, ipart) + charge_over_mass_*(*(Ez+ipart))*dts2;
+        umx = particles.momentum(0, ipart) + charge_over_mass_*(*(Ex+ipart-istart))*dts2;
+        umy = particles.momentum(1, ipart) + charge_over_mass_*(*(Ey+ipart-istart))*dts2;
+        umz = particles.momentum(2, ipart) + charge_over_mass_*(*(Ez+ipart-istart))*dts2;
         local_invgf  = 1. / sqrt( 1.0 + umx*umx + umy*umy + umz*umz );
 
         // Rotation in the magnetic field
         alpha = charge_over_mass_*dts2*local_invgf;
-        Tx    = alpha * (*(Bx+ipart));
-        Ty    = alpha * (*(By+ipart));
-        Tz    = alpha * (*(Bz+ipart));
+        Tx    = alpha * (*(Bx+ipart-istart));
+        Ty    = alpha * (*(By+ipart-istart));
+        Tz    = alpha * (*(Bz+ipart-istart));
         Tx2   = Tx*Tx;
         Ty2   = Ty*Ty;
         Tz2   = Tz*Tz;
@@ -128,10 +128,10 @@ void PusherRRLL::operator() (Particles &particles, SmileiMPI* smpi, int istart,
         upz = (      2.0*(TzTx+Ty)* umx  +      2.0*(TyTz-Tx)* umy  +  (1.0-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
 
         // Half-acceleration in the electric field
-        pxsm = upx + charge_over_mass_*(*(Ex+ipart))*dts2;
-        pysm = upy + charge_over_mass_*(*(Ey+ipart))*dts2;
-        pzsm = upz + charge_over_mass_*(*(Ez+ipart))*dts2;
-        (*invgf)[ipart] = 1. / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        pxsm = upx + charge_over_mass_*(*(Ex+ipart-istart))*dts2;
+        pysm = upy + charge_over_mass_*(*(Ey+ipart-istart))*dts2;
+        pzsm = upz + charge_over_mass_*(*(Ez+ipart-istart))*dts2;
+        (*invgf)[ipart-istart] = 1. / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
 
         particles.momentum(0, ipart) = pxsm;
         particles.momentum(1, ipart) = pysm;
@@ -139,7 +139,7 @@ void PusherRRLL::operator() (Particles &particles, SmileiMPI* smpi, int istart,
 
         // Move the particle
         for ( int i = 0 ; i<nDim_ ; i++ )
-            particles.position(i, ipart)     += dt*particles.momentum(i, ipart)*(*invgf)[ipart];
+            particles.position(i, ipart)     += dt*particles.momentum(i, ipart)*(*invgf)[ipart-istart];
 
         // COMPUTE Chi
         particles.chi(ipart)=0.5;
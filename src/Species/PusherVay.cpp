@@ -48,18 +48,18 @@ void PusherVay::operator() (Particles &particles, SmileiMPI* smpi, int istart, i
 
     double* momentum[3];
     for ( int i = 0 ; i<3 ; i++ )
-        momentum[i] =  &( particles.momentum(i,0) );
+        momentum[i] =  particles.getPtrMomentum(i);
     double* position[3];
     for ( int i = 0 ; i<nDim_ ; i++ )
-        position[i] =  &( particles.position(i,0) );
+        position[i] =  particles.getPtrPosition(i);
 #ifdef  __DEBUG
     double* position_old[3];
     for ( int i = 0 ; i<nDim_ ; i++ )
-        position_old[i] =  &( particles.position_old(i,0) );
+        position_old[i] =  particles.getPtrPositionOld(i);
 #endif
-    short* charge = &( particles.charge(0) );
+    short* charge = particles.getPtrCharge();
 
-    int nparts = particles.size();
+    int nparts = iend-istart;
     double* Ex = &( (*Epart)[0*nparts] );
     double* Ey = &( (*Epart)[1*nparts] );
     double* Ez = &( (*Epart)[2*nparts] );
@@ -75,23 +75,23 @@ void PusherVay::operator() (Particles &particles, SmileiMPI* smpi, int istart, i
         // Part I: Computation of uprime
 
         // For unknown reason, this has to be computed again
-        (*invgf)[ipart] = 1./sqrt(1.0 + momentum[0][ipart]*momentum[0][ipart] 
+        (*invgf)[ipart-istart] = 1./sqrt(1.0 + momentum[0][ipart]*momentum[0][ipart] 
                               + momentum[1][ipart]*momentum[1][ipart] 
                               + momentum[2][ipart]*momentum[2][ipart]);
 
         // Add Electric field
-        upx = momentum[0][ipart] + 2.*charge_over_mass_dts2*(*(Ex+ipart));
-        upy = momentum[1][ipart] + 2.*charge_over_mass_dts2*(*(Ey+ipart));
-        upz = momentum[2][ipart] + 2.*charge_over_mass_dts2*(*(Ez+ipart));
+        upx = momentum[0][ipart] + 2.*charge_over_mass_dts2*(*(Ex+ipart-istart));
+        upy = momentum[1][ipart] + 2.*charge_over_mass_dts2*(*(Ey+ipart-istart));
+        upz = momentum[2][ipart] + 2.*charge_over_mass_dts2*(*(Ez+ipart-istart));
 
         // Add magnetic field
-        Tx  = charge_over_mass_dts2* (*(Bx+ipart));
-        Ty  = charge_over_mass_dts2* (*(By+ipart));
-        Tz  = charge_over_mass_dts2* (*(Bz+ipart));
+        Tx  = charge_over_mass_dts2* (*(Bx+ipart-istart));
+        Ty  = charge_over_mass_dts2* (*(By+ipart-istart));
+        Tz  = charge_over_mass_dts2* (*(Bz+ipart-istart));
 
-        upx += (*invgf)[ipart]*(momentum[1][ipart]*Tz - momentum[2][ipart]*Ty); 
-        upy += (*invgf)[ipart]*(momentum[2][ipart]*Tx - momentum[0][ipart]*Tz);
-        upz += (*invgf)[ipart]*(momentum[0][ipart]*Ty - momentum[1][ipart]*Tx);
+        upx += (*invgf)[ipart-istart]*(momentum[1][ipart]*Tz - momentum[2][ipart]*Ty); 
+        upy += (*invgf)[ipart-istart]*(momentum[2][ipart]*Tx - momentum[0][ipart]*Tz);
+        upz += (*invgf)[ipart-istart]*(momentum[0][ipart]*Ty - momentum[1][ipart]*Tx);
 
         // alpha is gamma^2
         alpha = 1.0 + upx*upx + upy*upy + upz*upz;
@@ -132,7 +132,7 @@ void PusherVay::operator() (Particles &particles, SmileiMPI* smpi, int istart, i
         //pzsm = ((TzTx+Ty)* upx  + (TyTz-Tx)* upy + (1.0+Tz2)* upz)*s;
 
         // Inverse Gamma factor
-        (*invgf)[ipart] = 1.0 / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        (*invgf)[ipart-istart] = 1.0 / sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
 
         momentum[0][ipart] = pxsm;
         momentum[1][ipart] = pysm;
@@ -144,7 +144,7 @@ void PusherVay::operator() (Particles &particles, SmileiMPI* smpi, int istart, i
           position_old[i][ipart] = position[i][ipart];
 #endif
         for ( int i = 0 ; i<nDim_ ; i++ ) 
-            position[i][ipart]     += dt*momentum[i][ipart]*(*invgf)[ipart];
+            position[i][ipart]     += dt*momentum[i][ipart]*(*invgf)[ipart-istart];
 
     }
 }
@@ -138,6 +138,7 @@ void Species::initCluster(Params& params)
     nrj_mw_lost = 0.;
     nrj_new_particles = 0.;
     nrj_radiation = 0.;
+    measured_time = 0.;
 
 }//END initCluster
 
@@ -289,7 +290,7 @@ void Species::initPosition(unsigned int nPart, unsigned int iPart, double *index
 
         for (unsigned int p= iPart; p<iPart+nPart; p++) {
             for (unsigned int i=0; i<nDim_particle ; i++) {
-                particles->position(i,p)=indexes[i]+Rand::uniform()*cell_length[i];
+                particles->position(i,p)=indexes[i]+random.uniform()*cell_length[i];
             }
         }
 
@@ -335,8 +336,8 @@ void Species::initMomentum(unsigned int nPart, unsigned int iPart, double *temp,
             
             // Sample angles randomly and calculate the momentum
             for (unsigned int p=iPart; p<iPart+nPart; p++) {
-                double phi   = acos(-Rand::uniform2());
-                double theta = 2.0*M_PI*Rand::uniform();
+                double phi   = acos(-random.uniform2());
+                double theta = 2.0*M_PI*random.uniform();
                 double psm = sqrt(pow(1.0+energies[p-iPart],2)-1.0);
                 
                 particles->momentum(0,p) = psm*cos(theta)*sin(phi);
@@ -358,9 +359,9 @@ void Species::initMomentum(unsigned int nPart, unsigned int iPart, double *temp,
             
             double t0 = sqrt(temp[0]/mass), t1 = sqrt(temp[1]/mass), t2 = sqrt(temp[2]/mass);
             for (unsigned int p= iPart; p<iPart+nPart; p++) {
-                particles->momentum(0,p) = Rand::uniform2() * t0;
-                particles->momentum(1,p) = Rand::uniform2() * t1;
-                particles->momentum(2,p) = Rand::uniform2() * t2;
+                particles->momentum(0,p) = random.uniform2() * t0;
+                particles->momentum(1,p) = random.uniform2() * t1;
+                particles->momentum(2,p) = random.uniform2() * t2;
             }
         }
         
@@ -399,7 +400,7 @@ void Species::initMomentum(unsigned int nPart, unsigned int iPart, double *temp,
                               + pow(particles->momentum(2,p), 2) );
                 
                 CheckVelocity = ( vx*particles->momentum(0,p) + vy*particles->momentum(1,p) + vz*particles->momentum(2,p) ) / gp;
-                Volume_Acc = Rand::uniform();
+                Volume_Acc = random.uniform();
                 if (CheckVelocity > Volume_Acc){
                     
                     double Phi , Theta , vfl ,vflx , vfly, vflz, vpx , vpy , vpz ;
@@ -455,9 +456,9 @@ void Species::initMomentum(unsigned int nPart, unsigned int iPart, double *temp,
 
             //double gamma =sqrt(temp[0]*temp[0] + temp[1]*temp[1] + temp[2]*temp[2]);
             for (unsigned int p= iPart; p<iPart+nPart; p++) {
-                particles->momentum(0,p) = Rand::uniform2()*temp[0];
-                particles->momentum(1,p) = Rand::uniform2()*temp[1];
-                particles->momentum(2,p) = Rand::uniform2()*temp[2];
+                particles->momentum(0,p) = random.uniform2()*temp[0];
+                particles->momentum(1,p) = random.uniform2()*temp[1];
+                particles->momentum(2,p) = random.uniform2()*temp[2];
             }
 
         }
@@ -507,7 +508,11 @@ void Species::dynamics(double time_dual, unsigned int ispec,
     // -------------------------------
     if (time_dual>time_frozen) { // moving particle
 
-        smpi->dynamics_resize(ithread, nDim_particle, bmax.back());
+        double start_time = MPI_Wtime();
+
+        // Sort the particles by cell inside each bin
+        if (params.cell_sorting && (unsigned int)( time_dual/params.timestep ) % params.cell_sorting_every == 0)
+            count_sort_part(params);
 
         //Point to local thread dedicated buffers
         //Still needed for ionization
@@ -515,6 +520,9 @@ void Species::dynamics(double time_dual, unsigned int ispec,
 
         for (unsigned int ibin = 0 ; ibin < bmin.size() ; ibin++) {
 
+            // The thread buffers only hold the particles of the current bin,
+            // so that they stay in cache from the interpolation to the projection
+            smpi->dynamics_resize(ithread, nDim_particle, bmax[ibin]-bmin[ibin]);
 
             // Interpolate the fields at the particle position
             (*Interp)(EMfields, *particles, smpi, &(bmin[ibin]), &(bmax[ibin]), ithread );
@@ -579,7 +587,7 @@ void Species::dynamics(double time_dual, unsigned int ispec,
             {
                 for(unsigned int iwall=0; iwall<partWalls->size(); iwall++) {
                     for (iPart=bmin[ibin] ; (int)iPart<bmax[ibin]; iPart++ ) {
-                        double dtgf = params.timestep * smpi->dynamics_invgf[ithread][iPart];
+                        double dtgf = params.timestep * smpi->dynamics_invgf[ithread][iPart-bmin[ibin]];
                         if ( !(*partWalls)[iwall]->apply(*particles, iPart, this, dtgf, ener_iPart)) {
                             nrj_lost_per_thd[tid] += mass * ener_iPart;
                         }
@@ -600,7 +608,7 @@ void Species::dynamics(double time_dual, unsigned int ispec,
             } else if (mass==0) {
                 for(unsigned int iwall=0; iwall<partWalls->size(); iwall++) {
                     for (iPart=bmin[ibin] ; (int)iPart<bmax[ibin]; iPart++ ) {
-                        double dtgf = params.timestep * smpi->dynamics_invgf[ithread][iPart];
+                        double dtgf = params.timestep * smpi->dynamics_invgf[ithread][iPart-bmin[ibin]];
                         if ( !(*partWalls)[iwall]->apply(*particles, iPart, this, dtgf, ener_iPart)) {
                                 nrj_lost_per_thd[tid] += ener_iPart;
                         }
@@ -631,6 +639,8 @@ void Species::dynamics(double time_dual, unsigned int ispec,
         for (unsigned int ithd=0 ; ithd<nrj_lost_per_thd.size() ; ithd++)
             nrj_bc_lost += nrj_lost_per_thd[tid];
 
+        measured_time += MPI_Wtime() - start_time;
+
 //        // Add the ionized electrons to the electron species
 //        if (Ionize)
 //            electron_species->importParticles( params, patch, Ionize->new_electrons, localDiags );
@@ -787,145 +797,116 @@ void Species::computeCharge(unsigned int ispec, ElectroMagn* EMfields, Projector
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Sort particles
+// The particles which left the patch are replaced, bin by bin, by the particles arriving in the same bin (or by the
+// last particles of the bin). Then each bin is moved once to its final place, and the remaining arrivals are copied at
+// its end. The number of particle copies scales with the number of exchanged particles and with the imbalance
+// between departures and arrivals, not with the number of particles of the patch.
 // ---------------------------------------------------------------------------------------------------------------------
 void Species::sort_part(Params& params)
 {
     int ndim = params.nDim_field;
-    int idim;
-    //cleanup_sent_particles(ispec, indexes_of_particles_to_exchange);
-
-    //We have stored in indexes_of_particles_to_exchange the list of all particles that needs to be removed.
-    /********************************************************************************/
-    // Delete Particles included in the index of particles to exchange. Assumes indexes are sorted.
-    /********************************************************************************/
-    int ii, iPart;
-
-
-    // Push lost particles at the end of bins
-    for (unsigned int ibin = 0 ; ibin < bmax.size() ; ibin++ ) {
-        ii = indexes_of_particles_to_exchange.size()-1;
-        if (ii >= 0) { // Push lost particles to the end of the bin
-            iPart = indexes_of_particles_to_exchange[ii];
-            while (iPart >= bmax[ibin] && ii > 0) {
-                ii--;
-                iPart = indexes_of_particles_to_exchange[ii];
-            }
-            while (iPart == bmax[ibin]-1 && iPart >= bmin[ibin] && ii > 0) {
-                bmax[ibin]--;
-                ii--;
-                iPart = indexes_of_particles_to_exchange[ii];
-            }
-            while (iPart >= bmin[ibin] && ii > 0) {
-                particles->overwrite_part(bmax[ibin]-1, iPart );
-                bmax[ibin]--;
-                ii--;
-                iPart = indexes_of_particles_to_exchange[ii];
-            }
-            if (iPart >= bmin[ibin] && iPart < bmax[ibin]) { //On traite la dernière particule (qui peut aussi etre la premiere)
-                particles->overwrite_part(bmax[ibin]-1, iPart );
-                bmax[ibin]--;
-            }
-        }
-    }
-
-
-    //Shift the bins in memory
-    //Warning: this loop must be executed sequentially. Do not use openMP here.
-    for (int unsigned ibin = 1 ; ibin < bmax.size() ; ibin++ ) { //First bin don't need to be shifted
-        ii = bmin[ibin]-bmax[ibin-1]; // Shift the bin in memory by ii slots.
-        iPart = min(ii,bmax[ibin]-bmin[ibin]); // Number of particles we have to shift = min (Nshift, Nparticle in the bin)
-        if(iPart > 0) particles->overwrite_part(bmax[ibin]-iPart,bmax[ibin-1],iPart);
-        bmax[ibin] -= ii;
-        bmin[ibin] = bmax[ibin-1];
-    }
-
-
-
-    int nmove,lmove; // local, OK
-    int shift[bmax.size()+1];//how much we need to shift each bin in order to leave room for the new particle
-    double dbin;
-
-    dbin = params.cell_length[0]*params.clrw; //width of a bin.
-    for (unsigned int j=0; j<bmax.size()+1 ;j++){
-        shift[j]=0;
-    }
-
-
+    int nbin = bmax.size();
     int nbNeighbors_ = 2;
-    int n_part_recv;
-
-    indexes_of_particles_to_exchange.clear();
-    particles->erase_particle_trail(bmax.back());
-
-    //Evaluation of the necessary shift of all bins.2
-    for (unsigned int j=0; j<bmax.size()+1 ;j++){
-        shift[j]=0;
+    double dbin = params.cell_length[0]*params.clrw; //width of a bin.
+
+    // Departures of each bin: indexes_of_particles_to_exchange is sorted, and bins are contiguous
+    // (particles appended at the end of the array for a diagonal exchange belong to the last bin)
+    vector<int> dep_first( nbin+1, 0 );
+    int ndep = indexes_of_particles_to_exchange.size();
+    int ibin = 0;
+    for (int idep=0 ; idep<ndep ; idep++) {
+        while( ibin < nbin-1 && indexes_of_particles_to_exchange[idep] >= bmax[ibin] )
+            dep_first[++ibin] = idep;
     }
-
-    //idim=0
-    shift[1] += MPIbuff.part_index_recv_sz[0][0];//Particles coming from ymin all go to bin 0 and shift all the other bins.
-    shift[bmax.size()] += MPIbuff.part_index_recv_sz[0][1];//Used only to count the total number of particles arrived.
-    //idim>0
-    for (idim = 1; idim < ndim; idim++){
+    while( ibin < nbin )
+        dep_first[++ibin] = ndep;
+
+    // Arrivals of each bin, counting-sorted by bin
+    // Particles coming from xmin (xmax) all go to the first (last) bin
+    int narr = 0;
+    for (int idim = 0; idim < ndim; idim++)
+        for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++)
+            narr += MPIbuff.part_index_recv_sz[idim][iNeighbor];
+    vector<int> arr_first( nbin+1, 0 );
+    vector<int> arr_bin( narr );
+    int iarr = 0;
+    for (int idim = 0; idim < ndim; idim++) {
         for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-            n_part_recv = MPIbuff.part_index_recv_sz[idim][iNeighbor];
-            for (unsigned int j=0; j<(unsigned int)n_part_recv ;j++){
-                //We first evaluate how many particles arrive in each bin.
-                ii = int((MPIbuff.partRecv[idim][iNeighbor].position(0,j)-min_loc)/dbin);//bin in which the particle goes.
-                shift[ii+1]++; // It makes the next bins shift.
+            int n_part_recv = MPIbuff.part_index_recv_sz[idim][iNeighbor];
+            for (int j=0; j<n_part_recv ; j++) {
+                if( idim == 0 )
+                    ibin = iNeighbor*(nbin-1);
+                else
+                    ibin = int((MPIbuff.partRecv[idim][iNeighbor].position(0,j)-min_loc)/dbin);
+                arr_bin[iarr++] = ibin;
+                arr_first[ibin+1]++;
             }
         }
     }
-
-
-    //Must be done sequentially
-    for (unsigned int j=1; j<bmax.size()+1;j++){ //bin 0 is not shifted.Last element of shift stores total number of arriving particles.
-        shift[j]+=shift[j-1];
-    }
-    //Make room for new particles
-    if (shift[bmax.size()]) {
-        //! vecor::resize of Charge crashed ! Temporay solution : push_back / Particle
-        //particles->initialize( particles->size()+shift[bmax.size()], particles->Position.size() );
-        for (int inewpart=0 ; inewpart<shift[bmax.size()] ; inewpart++) particles->create_particle();
+    for (ibin=0 ; ibin<nbin ; ibin++)
+        arr_first[ibin+1] += arr_first[ibin];
+    vector<Particles*> arr_buffer( narr );
+    vector<int> arr_index( narr );
+    vector<int> arr_next( arr_first.begin(), arr_first.end()-1 );
+    iarr = 0;
+    for (int idim = 0; idim < ndim; idim++) {
+        for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
+            int n_part_recv = MPIbuff.part_index_recv_sz[idim][iNeighbor];
+            for (int j=0; j<n_part_recv ; j++) {
+                int k = arr_next[arr_bin[iarr++]]++;
+                arr_buffer[k] = &( MPIbuff.partRecv[idim][iNeighbor] );
+                arr_index [k] = j;
+            }
+        }
     }
 
-    //Shift bins, must be done sequentially
-    for (unsigned int j=bmax.size()-1; j>=1; j--){
-        int n_particles = bmax[j]-bmin[j]; //Nbr of particle in this bin
-        nmove = min(n_particles,shift[j]); //Nbr of particles to move
-        lmove = max(n_particles,shift[j]); //How far particles must be shifted
-        if (nmove>0) particles->overwrite_part(bmin[j], bmin[j]+lmove, nmove);
-        bmin[j] += shift[j];
-        bmax[j] += shift[j];
+    // In each bin, fill the holes with the arrivals of the bin, then with the last particles of the bin
+    // bin_size[ibin] is then the number of particles in the bin, and arr_next[ibin] the first remaining arrival
+    vector<int> bin_size( nbin );
+    for (ibin=0 ; ibin<nbin ; ibin++) {
+        arr_next[ibin] = arr_first[ibin];
+        int idep = dep_first[ibin];
+        for ( ; idep<dep_first[ibin+1] && arr_next[ibin]<arr_first[ibin+1] ; idep++, arr_next[ibin]++ )
+            arr_buffer[arr_next[ibin]]->overwrite_part( arr_index[arr_next[ibin]], *particles, indexes_of_particles_to_exchange[idep] );
+        int iend = bmax[ibin];
+        for (int jdep=dep_first[ibin+1]-1 ; jdep>=idep ; jdep--) {
+            iend--;
+            if( indexes_of_particles_to_exchange[jdep] < iend )
+                particles->overwrite_part( iend, indexes_of_particles_to_exchange[jdep] );
+        }
+        bin_size[ibin] = iend - bmin[ibin];
     }
+    indexes_of_particles_to_exchange.clear();
 
-    //Space has been made now to write the arriving particles into the correct bins
-    //idim == 0  is the easy case, when particles arrive either in first or last bin.
-    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-        n_part_recv = MPIbuff.part_index_recv_sz[0][iNeighbor];
-        //if ( (neighbor_[0][iNeighbor]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
-        if (                                               (n_part_recv!=0) ) {
-            ii = iNeighbor*(bmax.size()-1);//0 if iNeighbor=0(particles coming from Xmin) and bmax.size()-1 otherwise.
-            MPIbuff.partRecv[0][iNeighbor].overwrite_part(0, *particles,bmax[ii],n_part_recv);
-            bmax[ii] += n_part_recv ;
-        }
+    // New first index of each bin
+    vector<int> new_bmin( nbin+1, 0 );
+    for (ibin=0 ; ibin<nbin ; ibin++)
+        new_bmin[ibin+1] = new_bmin[ibin] + bin_size[ibin] + arr_first[ibin+1]-arr_next[ibin];
+    int n_particles = new_bmin[nbin];
+    if( n_particles > (int)particles->size() )
+        particles->create_particles( n_particles - particles->size() );
+
+    // Move the bins: a bin moved by shift slots requires min(shift, bin_size) copies
+    // Bins moving up are treated backward, then bins moving down are treated forward
+    for (ibin=nbin-1 ; ibin>=0 ; ibin--) {
+        int shift = new_bmin[ibin] - bmin[ibin];
+        if( shift > 0 && bin_size[ibin] > 0 )
+            particles->overwrite_part( bmin[ibin], bmin[ibin]+max(shift,bin_size[ibin]), min(shift,bin_size[ibin]) );
     }
-    //idim > 0; this is the difficult case, when particles can arrive in any bin.
-    for (idim = 1; idim < ndim; idim++){
-        //if (idim!=iDim) continue;
-        for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-            n_part_recv = MPIbuff.part_index_recv_sz[idim][iNeighbor];
-            //if ( (neighbor_[idim][iNeighbor]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
-            if (                                                  (n_part_recv!=0) ) {
-                for(unsigned int j=0; j<(unsigned int)n_part_recv; j++){
-                    ii = int((MPIbuff.partRecv[idim][iNeighbor].position(0,j)-min_loc)/dbin);//bin in which the particle goes.
-                    MPIbuff.partRecv[idim][iNeighbor].overwrite_part(j, *particles,bmax[ii]);
-                    bmax[ii] ++ ;
-                }
-            }
-        }
+    for (ibin=0 ; ibin<nbin ; ibin++) {
+        int shift = bmin[ibin] - new_bmin[ibin];
+        if( shift > 0 && bin_size[ibin] > 0 )
+            particles->overwrite_part( bmin[ibin]+bin_size[ibin]-min(shift,bin_size[ibin]), new_bmin[ibin], min(shift,bin_size[ibin]) );
     }
 
+    // Copy the remaining arrivals at the end of their bin
+    for (ibin=0 ; ibin<nbin ; ibin++) {
+        bmin[ibin] = new_bmin[ibin];
+        bmax[ibin] = new_bmin[ibin] + bin_size[ibin];
+        for ( ; bmax[ibin]<new_bmin[ibin+1] ; bmax[ibin]++, arr_next[ibin]++ )
+            arr_buffer[arr_next[ibin]]->overwrite_part( arr_index[arr_next[ibin]], *particles, bmax[ibin] );
+    }
+    particles->erase_particle_trail( n_particles );
 
     //The width of one bin is cell_length[0] * clrw.
 
@@ -985,74 +966,80 @@ void Species::sort_part(Params& params)
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Sort particles
+// Compute the cell keys: index of the cell containing each particle in the patch.
+// x is the slowest dimension, so that the cells of each cluster are contiguous.
 // ---------------------------------------------------------------------------------------------------------------------
-void Species::count_sort_part(Params &params)
+void Species::compute_part_cell_keys(Params &params)
 {
-    unsigned int ip, npart, ixy,tot, oc, nxy, token;
-    int ix,iy;
-    double x,y;
-
-    nxy = params.n_space[0]*params.n_space[1];
-    token = (particles == &particles_sorted[0]);
+    unsigned int npart = bmax.back();
+    particles->cell_keys.resize( npart );
+    if( npart == 0 ) return;
+
+    int* keys = &( particles->cell_keys[0] );
+    for (unsigned int ip=0; ip < npart; ip++)
+        keys[ip] = 0;
+
+    for (unsigned int idim=0; idim < nDim_particle; idim++) {
+        double* position = &( particles->position(idim,0) );
+        double xmin = min_loc_vec[idim];
+        double inv_cell_length = dx_inv_[idim];
+        int ncells = params.n_space[idim];
+        #pragma omp simd
+        for (unsigned int ip=0; ip < npart; ip++) {
+            int ix = (int) floor( (position[ip]-xmin) * inv_cell_length );
+            // Particles exactly on the upper border belong to the last cell
+            ix = ix < 0 ? 0 : ( ix < ncells ? ix : ncells-1 );
+            keys[ip] = keys[ip]*ncells + ix;
+        }
+    }
+}
 
-    int indices[nxy];
-    npart = particles->size();
-    //particles_sorted = particles ;
-    particles_sorted[token].initialize(npart, *particles);
+// ---------------------------------------------------------------------------------------------------------------------
+// Sort particles by cell, with a counting sort on the cell keys.
+// Particles are copied in the spare buffer particles_sorted, which is then exchanged with the particles.
+// The bins are rebuilt from the cells: bin ibin gathers the clrw*ny*nz cells starting at ibin*clrw*ny*nz.
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::count_sort_part(Params &params)
+{
+    unsigned int npart = bmax.back();
+    unsigned int ncells = 1;
+    for (unsigned int idim=0; idim < nDim_particle; idim++)
+        ncells *= params.n_space[idim];
 
-    for (unsigned int i=0; i < nxy ; i++) indices[i] = 0 ;
+    compute_part_cell_keys( params );
+    vector<int> &keys = particles->cell_keys;
 
     // first loop counts the # of particles in each cell
-    for (ip=0; ip < npart; ip++)
-        {
-            x = particles->position(0,ip)-min_loc;
-            y = particles->position(1,ip)-min_loc_vec[1];
-
-            ix = floor(x * dx_inv_[0]) ;
-            iy = floor(y * dx_inv_[1]) ;
-
-            ixy = iy + ix*params.n_space[1];
-
-
-            indices[ixy] ++;
-        }
+    cell_start.assign( ncells+1, 0 );
+    for (unsigned int ip=0; ip < npart; ip++)
+        cell_start[keys[ip]+1] ++;
 
     // second loop convert the count array in cumulative sum
-    tot=0;
-    for (unsigned int ixy=0; ixy < nxy; ixy++)
-        {
-            oc = indices[ixy];
-            indices[ixy] = tot;
-            tot += oc;
-        }
-
-    //Bookmarking is not needed if normal sort is called before.
-    //bmin[0] = 0;
-    //for (bin=0; bin<bmin.size()-1; bin++) { //Loop on the bins.
-    //
-    //    bmin[bin+1] = indices[(bin+1)*params.n_space[1]*clrw] ;
-    //    bmax[bin] = bmin[bin+1];
-    //}
-    //bin = bmin.size()-1 ;
-    //bmax[bin] = npart;
-
-    // last loop puts the particles and update the count array
-    for (ip=0; ip < npart; ip++) {
-        x = particles->position(0,ip)-min_loc;
-        y = particles->position(1,ip)-min_loc_vec[1];
-
-        ix = floor(x * dx_inv_[1]) ;
-        iy = floor(y * dx_inv_[2]) ;
-
-        ixy = iy + ix*params.n_space[1];
-
-        particles->overwrite_part(ip, particles_sorted[token] , indices[ixy]);
-        indices[ixy]++;
+    for (unsigned int ic=1; ic <= ncells; ic++)
+        cell_start[ic] += cell_start[ic-1];
+
+    if( npart > 0 ) {
+        // last loop computes the new location of each particle
+        cell_next.assign( cell_start.begin(), cell_start.end()-1 );
+        for (unsigned int ip=0; ip < npart; ip++)
+            keys[ip] = cell_next[keys[ip]]++;
+
+        Particles &sorted = ( particles == &particles_sorted[0] ) ? particles_sorted[1] : particles_sorted[0];
+        sorted.initialize( npart, *particles );
+        particles->overwrite_parts( sorted, keys );
+        particles->swap( sorted );
+
+        // The keys now follow the sorted particles
+        for (unsigned int ic=0; ic < ncells; ic++)
+            for (int ip=cell_start[ic]; ip < cell_start[ic+1]; ip++)
+                particles->cell_keys[ip] = ic;
     }
 
-    particles = &particles_sorted[token] ;
-
+    unsigned int ncells_bin = clrw * ( ncells / params.n_space[0] );
+    for (unsigned int ibin=0; ibin < bmin.size(); ibin++) {
+        bmin[ibin] = cell_start[ ibin   *ncells_bin];
+        bmax[ibin] = cell_start[(ibin+1)*ncells_bin];
+    }
 }
 
 
@@ -1064,6 +1051,9 @@ int Species::createParticles(vector<unsigned int> n_space_to_create, Params& par
     std::vector<int> my_particles_indices;
     vector<Field*> xyz(nDim_field);
 
+    // The random stream depends on the location, so that the moving window creates new particles
+    random.init( params.random_seed, patch->hindex, Random::stream_creation + speciesNumber, patch->getCellStartingGlobalIndex(0) );
+
     // Create particles in a space starting at cell_position
     vector<double> cell_position(3,0);
     vector<double> cell_index(3,0);
@@ -1449,7 +1439,7 @@ vector<double> Species::maxwellJuttner(unsigned int npoints, double temperature)
         // For each particle
         for( unsigned int i=0; i<npoints; i++ ) {
             // Pick a random number
-            U = Rand::uniform();
+            U = random.uniform();
             // Calculate the inverse of F
             lnlnU = log(-log(U));
             if( lnlnU>2. ) {
@@ -1478,7 +1468,7 @@ vector<double> Species::maxwellJuttner(unsigned int npoints, double temperature)
         for( unsigned int i=0; i<npoints; i++ ) {
             do {
                 // Pick a random number
-                U = Rand::uniform();
+                U = random.uniform();
                 // Calculate the inverse of H at the point log(1.-U) + H0
                 lnU = log(-log(1.-U) - H0);
                 if( lnU<-26. ) {
@@ -1494,7 +1484,7 @@ vector<double> Species::maxwellJuttner(unsigned int npoints, double temperature)
                 // Make a first guess for the value of gamma
                 gamma = temperature * invH;
                 // We use the rejection method, so we pick another random number
-                U = Rand::uniform();
+                U = random.uniform();
                 // And we are done only if U < beta, otherwise we try again
             } while( U >= sqrt(1.-1./(gamma*gamma) ) );
             // Store that value of the energy
@@ -18,6 +18,7 @@
 #include "RadiationTables.h"
 #include "MultiphotonBreitWheeler.h"
 #include "MultiphotonBreitWheelerTables.h"
+#include "Random.h"
 
 class ElectroMagn;
 class Pusher;
@@ -134,6 +135,9 @@ public:
     
     SpeciesMPIbuffers MPIbuff;
     
+    //! Random number generator of the species in this patch, re-initialized at each timestep
+    Random random;
+    
     //! Maximum charge at initialization
     double max_charge;
     
@@ -187,6 +191,11 @@ public:
     unsigned int clrw; //Should divide the number of cells in X of a single MPI domain.
     //! first and last index of each particle bin
     std::vector<int> bmin, bmax;
+    //! first index of the particles of each cell of the patch (last element = number of particles),
+    //! only valid in the particle dynamics when particles are sorted by cell (cell_sorting)
+    std::vector<int> cell_start;
+    //! next free position of each cell while sorting the particles by cell
+    std::vector<int> cell_next;
     //!
     std::vector<int> species_loc_bmax;
     //! sub dimensions of buffers for dim > 1
@@ -228,6 +237,8 @@ public:
     double nrj_mw_lost;
     //! Accumulate nrj added with new particles
     double nrj_new_particles;
+    //! Time spent in the particle loop since the last load balancing (measured load of the patch)
+    double measured_time;
     
     // -----------------------------------------------------------------------------
     //  4. Operators
@@ -314,7 +325,10 @@ public:
     
     //! Method used to sort particles
     virtual void sort_part(Params& param);
+    //! Method used to sort particles by cell (counting sort on the cell keys)
     void count_sort_part(Params& param);
+    //! Method used to compute the cell keys of the particles
+    void compute_part_cell_keys(Params& param);
 
     //! 
     virtual void add_space_for_a_particle() {
@@ -94,12 +94,12 @@ public:
                  // Species with nonrelativistic Boris pusher == 'borisnr'
                  // Species with J.L. Vay pusher if == "vay"
                  // Species with Higuary Cary pusher if == "higueracary"
-                if ( (!params.vecto) || (pusher != "boris") )
-                    thisSpecies = new SpeciesNorm(params, patch);
 #ifdef _VECTO
-                else
+                if ( params.vecto && pusher == "boris" )
                     thisSpecies = new SpeciesV(params, patch);
+                else
 #endif
+                    thisSpecies = new SpeciesNorm(params, patch);
             } else {
                 ERROR("For species `" << species_name << "`, pusher must be 'boris', 'borisnr', 'vay', 'higueracary'");
             }
@@ -630,12 +630,12 @@ public:
         || species->pusher =="borisnr")
         {
             // Boris, Vay or Higuera-Cary
-            if ( (!params.vecto) || (species->pusher != "boris") )
-                newSpecies = new SpeciesNorm(params, patch);
 #ifdef _VECTO
-            else
+            if ( params.vecto && species->pusher == "boris" )
                 newSpecies = new SpeciesV(params, patch);
+            else
 #endif
+                newSpecies = new SpeciesNorm(params, patch);
         }
         // Copy members
         newSpecies->name                                     = species->name;
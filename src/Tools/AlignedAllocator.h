@@ -0,0 +1,60 @@
+#ifndef ALIGNEDALLOCATOR_H
+#define ALIGNEDALLOCATOR_H
+
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class AlignedAllocator : std allocator returning memory aligned on `alignment` bytes
+//!
+//! Used for the particle arrays so that the first particle of each array starts on a cache line
+//! (and on a full SIMD register, up to AVX-512).
+//  --------------------------------------------------------------------------------------------------------------------
+template<class T, std::size_t alignment=64>
+class AlignedAllocator {
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template<class U>
+    struct rebind {
+        typedef AlignedAllocator<U, alignment> other;
+    };
+
+    AlignedAllocator() {}
+    template<class U>
+    AlignedAllocator( const AlignedAllocator<U, alignment> & ) {}
+
+    T* allocate( std::size_t n ) {
+        if( n == 0 ) return NULL;
+        void* p = NULL;
+        if( posix_memalign( &p, alignment, n*sizeof(T) ) != 0 ) throw std::bad_alloc();
+        return static_cast<T*>(p);
+    }
+
+    void deallocate( T* p, std::size_t ) {
+        free( p );
+    }
+};
+
+template<class T, class U, std::size_t alignment>
+inline bool operator==( const AlignedAllocator<T, alignment> &, const AlignedAllocator<U, alignment> & ) {
+    return true;
+}
+template<class T, class U, std::size_t alignment>
+inline bool operator!=( const AlignedAllocator<T, alignment> &, const AlignedAllocator<U, alignment> & ) {
+    return false;
+}
+
+//! std::vector whose data is aligned on 64 bytes
+template<class T>
+using aligned_vector = std::vector<T, AlignedAllocator<T> >;
+
+#endif
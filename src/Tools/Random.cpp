@@ -0,0 +1,56 @@
+#include "Random.h"
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set the key and counter of the generator. The block number starts at zero.
+// ---------------------------------------------------------------------------------------------------------------------
+void Random::init( uint32_t seed, uint32_t hindex, uint32_t stream, uint32_t step )
+{
+    key_[0] = seed;
+    key_[1] = hindex;
+    ctr_[0] = 0;
+    ctr_[1] = 0;
+    ctr_[2] = stream;
+    ctr_[3] = step;
+    ibuffer_ = 4;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Batched generation: each block of the stream provides two doubles. Blocks are independent,
+// so that the loop can be vectorized. The remainder of the current block (if any) is discarded.
+// ---------------------------------------------------------------------------------------------------------------------
+void Random::uniform( double *array, unsigned int n )
+{
+    unsigned int nblocks = ( n+1 )/2;
+    uint64_t start = ( ( uint64_t )ctr_[1] << 32 ) | ctr_[0];
+    uint32_t c2 = ctr_[2], c3 = ctr_[3], k0 = key_[0], k1 = key_[1];
+
+    #pragma omp simd
+    for( unsigned int i=0; i<n/2; i++ ) {
+        uint64_t block = start + i;
+        uint32_t out[4];
+        philox( ( uint32_t )block, ( uint32_t )( block >> 32 ), c2, c3, k0, k1, out );
+        array[2*i  ] = to_double( out[0], out[1] );
+        array[2*i+1] = to_double( out[2], out[3] );
+    }
+    // Odd number of values
+    if( n%2 ) {
+        uint64_t block = start + nblocks - 1;
+        uint32_t out[4];
+        philox( ( uint32_t )block, ( uint32_t )( block >> 32 ), c2, c3, k0, k1, out );
+        array[n-1] = to_double( out[0], out[1] );
+    }
+
+    start += nblocks;
+    ctr_[0] = ( uint32_t )start;
+    ctr_[1] = ( uint32_t )( start >> 32 );
+    ibuffer_ = 4;
+}
+
+void Random::uniform2( double *array, unsigned int n )
+{
+    uniform( array, n );
+    #pragma omp simd
+    for( unsigned int i=0; i<n; i++ ) {
+        array[i] = 2.*array[i] - 1.;
+    }
+}
@@ -0,0 +1,115 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cmath>
+#include <cstdint>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class Random : counter-based random number generator (Philox4x32-10, Salmon et al., SC'11)
+//!
+//! The generator has no sequential state other than a counter: the n-th number of a stream is
+//! a pure function of (seed, hindex, stream, step, n). Each patch operator (species dynamics,
+//! particle creation, collisions) re-initializes its own generator at every timestep, so that
+//! results do not depend on the number of threads or MPI processes, and restarts are exact.
+//  --------------------------------------------------------------------------------------------------------------------
+class Random {
+public:
+    //! Kinds of streams (stored in the 8 upper bits of the stream number)
+    static const uint32_t stream_dynamics   = 0u << 24;
+    static const uint32_t stream_creation   = 1u << 24;
+    static const uint32_t stream_collisions = 2u << 24;
+
+    Random() {
+        init( 0, 0, 0, 0 );
+    }
+
+    //! Set the key (seed, patch hindex) and the counter (stream, step) of the generator
+    void init( uint32_t seed, uint32_t hindex, uint32_t stream, uint32_t step );
+
+    //! Uniform random number in [0,1)
+    inline double uniform() {
+        uint32_t a = next();
+        uint32_t b = next();
+        return to_double( a, b );
+    }
+    //! Uniform random number in [0,1-1e-11)
+    inline double uniform1() {
+        return uniform() * ( 1.-1e-11 );
+    }
+    //! Uniform random number in [-1,1)
+    inline double uniform2() {
+        return 2.*uniform() - 1.;
+    }
+    //! Normally distributed random number (Box-Muller)
+    inline double normal( double stddev ) {
+        double r     = std::sqrt( -2.*std::log( 1.-uniform() ) );
+        double theta = 2.*M_PI * uniform();
+        return stddev * r * std::cos( theta );
+    }
+
+    //! Fill an array with n uniform random numbers in [0,1)
+    void uniform( double *array, unsigned int n );
+    //! Fill an array with n uniform random numbers in [-1,1)
+    void uniform2( double *array, unsigned int n );
+
+    // Interface of a UniformRandomBitGenerator (for instance for std::shuffle)
+    typedef uint32_t result_type;
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_MAX; }
+    inline result_type operator()() { return next(); }
+
+private:
+    //! Key of the generator (seed, hindex)
+    uint32_t key_[2];
+    //! Counter: 64-bit block number, stream number, step
+    uint32_t ctr_[4];
+    //! Output of the last block and position in it
+    uint32_t buffer_[4];
+    unsigned int ibuffer_;
+
+    //! Return the next 32-bit word of the stream
+    inline uint32_t next() {
+        if( ibuffer_ == 4 ) {
+            philox( ctr_[0], ctr_[1], ctr_[2], ctr_[3], key_[0], key_[1], buffer_ );
+            increment();
+            ibuffer_ = 0;
+        }
+        return buffer_[ibuffer_++];
+    }
+
+    //! Go to the next block of the stream
+    inline void increment() {
+        if( ++ctr_[0] == 0 ) {
+            ++ctr_[1];
+        }
+    }
+
+    //! Convert two 32-bit words to a double in [0,1) with 53 random bits
+    static inline double to_double( uint32_t a, uint32_t b ) {
+        uint64_t u = ( ( ( uint64_t )a << 32 ) | b ) >> 11;
+        return ( double )u * ( 1.0/9007199254740992.0 );
+    }
+
+    //! The Philox4x32 bijection (10 rounds)
+    static inline void philox( uint32_t c0, uint32_t c1, uint32_t c2, uint32_t c3,
+                               uint32_t k0, uint32_t k1, uint32_t *out ) {
+        for( unsigned int round=0; round<10; round++ ) {
+            uint64_t p0 = ( uint64_t )0xD2511F53u * c0;
+            uint64_t p1 = ( uint64_t )0xCD9E8D57u * c2;
+            uint32_t n0 = ( uint32_t )( p1 >> 32 ) ^ c1 ^ k0;
+            uint32_t n2 = ( uint32_t )( p0 >> 32 ) ^ c3 ^ k1;
+            c0 = n0;
+            c1 = ( uint32_t )p1;
+            c2 = n2;
+            c3 = ( uint32_t )p0;
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+        out[0] = c0;
+        out[1] = c1;
+        out[2] = c2;
+        out[3] = c3;
+    }
+};
+
+#endif
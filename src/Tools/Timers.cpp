@@ -17,6 +17,7 @@ Timers::Timers( SmileiMPI * smpi ) :
     collisions("Collisions"    ), // Call to Collisions methods
     movWindow ("Mov window"    ), // Moving Window
     loadBal   ("Load balancing" ), // Load balancing
+    checkpoint("Checkpoints"   ), // Dumps (only the staging of asynchronous dumps)
     syncPart  ("Sync Particles"), // Call exchangeParticles (MPI & Patch sync)
     syncField ("Sync Fields"   ), // Call sumRhoJ(s), exchangeB (MPI & Patch sync)
     syncDens  ("Sync Densities"),  // If necessary the following timers can be reintroduced
@@ -31,6 +32,7 @@ Timers::Timers( SmileiMPI * smpi ) :
     timers.push_back( &collisions );
     timers.push_back( &movWindow  );
     timers.push_back( &loadBal    );
+    timers.push_back( &checkpoint );
     timers.push_back( &syncPart   );
     timers.push_back( &syncField  );
     timers.push_back( &syncDens   );
@@ -26,6 +26,7 @@ public:
     Timer collisions;
     Timer movWindow ;
     Timer loadBal   ;
+    Timer checkpoint;
     Timer syncPart  ;
     Timer syncField ;
     Timer syncDens  ;
@@ -0,0 +1,19 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# The random streams only depend on (seed, patch, timestep): restarted runs must
+# reproduce the same stochastic events, hence the tight tolerances
+
+# SCALARS RELATED TO SPECIES
+Validate("Scalar Ntot_electron", S.Scalar.Ntot_electron().getData(), 0.5)
+Validate("Scalar Ukin_electron", S.Scalar.Ukin_electron().getData(), 1e-10)
+Validate("Scalar Zavg_carbon"  , S.Scalar.Zavg_carbon  ().getData(), 1e-10)
+
+# CHARGE STATES OF CARBON
+charge = np.array( S.ParticleBinning.Diag0().getData() )
+Validate("Carbon charge distribution vs time", charge, 1e-10)
+
+# TOTAL ENERGY
+Validate("Scalar Utot", S.Scalar.Utot().getData(), 1e-10)
@@ -0,0 +1,14 @@
+import os, re, numpy as np
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+
+
+# The reference was generated with the scalar projectors (Main.vecto=False):
+# the vectorized projectors only change the order of the summations
+for field in ["Jx", "Jy", "Jz", "Ex", "Ey", "Ez"]:
+	F = S.Field.Field0(field, timesteps=40).getData()[0][::2,::2,::2]
+	Validate(field+" field at iteration 40", F, np.abs(F).max()*1e-6)
+
+Validate("Scalar Utot", S.Scalar.Utot().getData(), 1e-8)